@@ -0,0 +1,46 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/compact_property_maps.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/point_generators_3.h>
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+
+typedef CGAL::Point_set_3<Point> Point_set;
+
+// 4 bytes per normal instead of 24
+typedef std::array<std::int16_t, 2> Octahedral_normal;
+typedef Point_set::Property_map<Octahedral_normal> Octahedral_property;
+typedef CGAL::Octahedral_normal_map<Vector, Octahedral_property> Normal_map;
+
+int main (int, char**)
+{
+  Point_set point_set;
+
+  CGAL::Random_points_on_sphere_3<Point> generator(1.);
+  std::size_t nb_pts = 10000;
+  point_set.reserve (nb_pts);
+  for (std::size_t i = 0; i < nb_pts; ++ i)
+    point_set.insert (*(generator ++));
+
+  // Normals are stored in a compact property, and decoded on access
+  Normal_map normal_map (point_set.add_property_map<Octahedral_normal> ("normal").first);
+
+  CGAL::jet_estimate_normals<CGAL::Sequential_tag>
+    (point_set,
+     12, // Number of neighbors
+     CGAL::parameters::point_map (point_set.point_map()).
+     normal_map (normal_map));
+
+  Point_set::Index idx = *(point_set.begin());
+  std::cout << "Point " << point_set.point(idx)
+            << " has normal " << get (normal_map, idx) << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -26,10 +26,18 @@
 #include <CGAL/demangle.h>
 #include <CGAL/assertions.h>
 
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <sstream>
 #include <stack>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -315,17 +323,20 @@ public:
     be copied and no property will be lost in the process.
 
     \note Garbage is collected in both point sets when calling this method.
+
+    \tparam ConcurrencyTag enables the parallel garbage collection and
+    copy of the property maps. Possible values are `Sequential_tag`,
+    `Parallel_tag`, and `Parallel_if_available_tag`.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   bool join (Point_set_3& other)
   {
-    collect_garbage();
-    other.collect_garbage();
+    collect_garbage<ConcurrencyTag>();
+    other.template collect_garbage<ConcurrencyTag>();
     resize (number_of_points() + other.number_of_points());
-    m_base.transfer (other.m_base);
+    m_base.template transfer<ConcurrencyTag> (other.m_base);
 
-    // Reset indices
-    for (std::size_t i = 0; i < this->m_base.size(); ++ i)
-      this->m_indices[i] = i;
+    reset_indices<ConcurrencyTag>();
 
     return true;
   }
@@ -354,6 +365,7 @@ public:
   void clear_properties()
   {
     Base other;
+    other.set_memory_resource(m_base.memory_resource());
     other.template add<Index>("index", typename Index::size_type(-1));
     other.template add<Point>("point", CGAL::ORIGIN);
     other.resize(m_base.size());
@@ -374,6 +386,40 @@ public:
    */
   void reserve (std::size_t s) { m_base.reserve (s); }
 
+  /*!
+    \brief is the base class of the memory resources that can be used to
+    allocate the properties of the point set.
+
+    A memory resource overrides the functions `void* allocate(std::size_t bytes, std::size_t alignment)`
+    and `void deallocate(void* p, std::size_t bytes, std::size_t alignment)`.
+    It can for example allocate from an arena, from a memory mapped file, or
+    from memory local to a NUMA node.
+  */
+  typedef Properties::Memory_resource Memory_resource;
+
+  /*!
+    \brief is a memory resource aligning the allocations larger than 2MB to 2MB,
+    and asking the system to back them with transparent huge pages when it is
+    possible (Linux), which reduces the TLB misses when accessing large point sets.
+  */
+  typedef Properties::Huge_page_memory_resource Huge_page_memory_resource;
+
+  /*!
+    \brief allocates all the properties of the point set, including the ones added
+    later, with `resource`, or with `std::allocator` if `resource` is null.
+
+    The existing properties are moved to the new memory.
+    The memory resource is also used by the copies of the point set, and must
+    outlive them.
+   */
+  void set_memory_resource (Memory_resource* resource) { m_base.set_memory_resource (resource); }
+
+  /*!
+    \brief returns the memory resource used to allocate the properties, or
+    null if they are allocated with `std::allocator`.
+   */
+  Memory_resource* memory_resource () const { return m_base.memory_resource(); }
+
   /*!
     \brief changes size of the point set.
 
@@ -604,7 +650,6 @@ public:
         while (source != last // All elements have been moved
                && dest != last - 1) // All elements are at the end of the container
           {
-            std::cerr << "Swapping " << *source << " and " << *dest << std::endl;
             std::swap (*(source ++), *(dest --));
           }
       }
@@ -713,9 +758,31 @@ public:
 
   /*!
     \brief erases from memory the elements marked as removed.
+
+    The remaining elements are stored in memory in the order of the
+    range `[begin(), end())`: sorting this range (for example with
+    `hilbert_sort()` or `std::sort()`) and then calling this method
+    reorders all the properties accordingly (see also `reorder_spatially()`).
+
+    \tparam ConcurrencyTag enables the parallel compaction of the
+    property maps. Possible values are `Sequential_tag`,
+    `Parallel_tag`, and `Parallel_if_available_tag`.
+    The result does not depend on this tag, but the parallel version
+    allocates a copy of each property map.
   */
+  template <typename ConcurrencyTag = Sequential_tag>
   void collect_garbage ()
   {
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // the property at position i of the range is moved to index i
+      std::vector<std::size_t> old_indices (m_indices.begin(), end());
+      m_base.template permute<ConcurrencyTag> (old_indices);
+      reset_indices<ConcurrencyTag>();
+      m_nb_removed = 0;
+      return;
+    }
+
     // Indices indicate where to get the properties
     std::vector<std::size_t> indices (m_base.size());
     for (std::size_t i = 0; i < m_base.size(); ++ i)
@@ -750,8 +817,7 @@ public:
   void cancel_removals()
   {
     m_nb_removed = 0;
-    for (std::size_t i = 0; i < this->m_base.size(); ++ i)
-      this->m_indices[i] = i;
+    reset_indices<Sequential_tag>();
   }
 
   /// @}
@@ -1241,6 +1307,27 @@ public:
 
 private:
   /// \cond SKIP_IN_MANUAL
+  template <typename ConcurrencyTag>
+  void reset_indices ()
+  {
+    const std::size_t n = m_base.size();
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      tbb::parallel_for (tbb::blocked_range<std::size_t>(0, n),
+                         [&](const tbb::blocked_range<std::size_t>& r)
+                         {
+                           for (std::size_t i = r.begin(); i != r.end(); ++ i)
+                             m_indices[i] = i;
+                         });
+    else
+#endif
+      for (std::size_t i = 0; i < n; ++ i)
+        m_indices[i] = i;
+  }
+
   void quick_sort_on_indices (std::ptrdiff_t begin, std::ptrdiff_t end)
   {
     std::stack<std::pair<std::ptrdiff_t, std::ptrdiff_t> >
@@ -0,0 +1,465 @@
+// Copyright (c) 2026  GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_POINT_SET_3_COMPACT_PROPERTY_MAPS_H
+#define CGAL_POINT_SET_3_COMPACT_PROPERTY_MAPS_H
+
+#include <CGAL/license/Point_set_3.h>
+
+#include <CGAL/assertions.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/number_utils.h>
+
+#include <boost/property_map/property_map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace CGAL {
+
+/*!
+  \ingroup PkgPointSet3Ref
+
+  \brief 16-bit floating point number (IEEE 754 binary16).
+
+  It has 11 significant bits and represents numbers of magnitude up to 65504.
+  The conversion from `float` rounds to the nearest representable value,
+  ties to even.
+*/
+class Half_float
+{
+  std::uint16_t m_bits;
+
+public:
+
+  /// constructs `0`.
+  Half_float() : m_bits(0) { }
+
+  /// constructs the value nearest to `f`.
+  Half_float(float f) : m_bits(from_float(f)) { }
+
+  /// returns the value as a `float` (this conversion is exact).
+  operator float() const { return to_float(m_bits); }
+
+  /// returns the binary representation.
+  std::uint16_t bits() const { return m_bits; }
+
+  /// constructs the value of binary representation `bits`.
+  static Half_float from_bits(std::uint16_t bits)
+  {
+    Half_float h;
+    h.m_bits = bits;
+    return h;
+  }
+
+private:
+
+  static std::uint16_t from_float(float f)
+  {
+    std::uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+
+    const std::uint16_t sign = std::uint16_t((x >> 16) & 0x8000);
+    const std::uint32_t exponent = (x >> 23) & 0xff;
+    std::uint32_t mantissa = x & 0x7fffff;
+
+    if (exponent == 0xff) // infinity or NaN, which is kept quiet
+      return std::uint16_t(sign | 0x7c00 | (mantissa != 0 ? 0x200 | (mantissa >> 13) : 0));
+
+    const int e = int(exponent) - 127 + 15;
+    if (e >= 31) // overflow
+      return std::uint16_t(sign | 0x7c00);
+
+    if (e <= 0) // subnormal (or zero) half float
+    {
+      if (e < -10)
+        return sign;
+      mantissa |= 0x800000;
+      const int shift = 14 - e;
+      std::uint32_t m = mantissa >> shift;
+      const std::uint32_t remainder = mantissa & ((std::uint32_t(1) << shift) - 1);
+      const std::uint32_t halfway = std::uint32_t(1) << (shift - 1);
+      if (remainder > halfway || (remainder == halfway && (m & 1)))
+        ++ m; // may give the smallest normal number, which is correctly encoded
+      return std::uint16_t(sign | m);
+    }
+
+    std::uint16_t h = std::uint16_t(sign | (e << 10) | (mantissa >> 13));
+    const std::uint32_t remainder = mantissa & 0x1fff;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (h & 1)))
+      ++ h; // the carry may propagate to the exponent, up to infinity
+    return h;
+  }
+
+  static float to_float(std::uint16_t h)
+  {
+    const std::uint32_t sign = std::uint32_t(h & 0x8000) << 16;
+    const std::uint32_t exponent = (h >> 10) & 0x1f;
+    const std::uint32_t mantissa = h & 0x3ff;
+
+    if (exponent == 0) // zero or subnormal
+    {
+      const float f = std::ldexp(float(mantissa), -24);
+      return sign != 0 ? -f : f;
+    }
+
+    std::uint32_t x;
+    if (exponent == 31) // infinity or NaN
+      x = sign | 0x7f800000 | (mantissa << 13);
+    else
+      x = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+  }
+};
+
+/*!
+  \ingroup PkgPointSet3Ref
+
+  \brief Property map storing 3D unit vectors, such as normals, in
+  two signed integers using the octahedral encoding.
+
+  The direction is projected on the octahedron \f$|x|+|y|+|z| = 1\f$,
+  whose lower half is folded over the upper half, and the two
+  coordinates in the plane \f$z = 0\f$ are quantized on the full range
+  of `Integer`. With `std::int16_t`, a normal takes 4 bytes instead of
+  24, and the angular error is below \f$ 10^{-4} \f$ radians.
+
+  Only the direction is stored: `get()` returns a vector of unit
+  length (up to rounding). The null vector is stored as a reserved
+  value and is returned as the null vector.
+
+  \tparam Vector a model of `Kernel::Vector_3`
+  \tparam PropertyMap a model of `ReadWritePropertyMap` whose value type
+  is `std::array<Integer, 2>`, where `Integer` is a signed integer type,
+  for example a property map of `Point_set_3` created with
+  `add_property_map<std::array<std::int16_t, 2> >()`
+
+  \cgalModels{ReadWritePropertyMap}
+*/
+template <typename Vector, typename PropertyMap>
+class Octahedral_normal_map
+{
+public:
+
+  /// \cond SKIP_IN_MANUAL
+  typedef typename boost::property_traits<PropertyMap>::key_type key_type;
+  typedef Vector value_type;
+  typedef value_type reference;
+  typedef boost::read_write_property_map_tag category;
+
+  typedef typename boost::property_traits<PropertyMap>::value_type Encoded;
+  typedef typename Encoded::value_type Integer;
+  static_assert(std::is_integral<Integer>::value && std::is_signed<Integer>::value,
+                "Octahedral_normal_map requires signed integers.");
+  typedef typename Kernel_traits<Vector>::Kernel::FT FT;
+  /// \endcond
+
+  /// constructs a map that encodes the vectors in `map`.
+  Octahedral_normal_map(PropertyMap map = PropertyMap()) : m_map(map) { }
+
+  /// returns the underlying property map.
+  const PropertyMap& property_map() const { return m_map; }
+
+  /// returns the encoding of `v`.
+  static Encoded encode(const Vector& v)
+  {
+    const double x = CGAL::to_double(v.x());
+    const double y = CGAL::to_double(v.y());
+    const double z = CGAL::to_double(v.z());
+
+    const double l1 = std::abs(x) + std::abs(y) + std::abs(z);
+    if (l1 == 0.)
+      return {{ (std::numeric_limits<Integer>::min)(), (std::numeric_limits<Integer>::min)() }};
+
+    double u = x / l1, w = y / l1;
+    if (z < 0.)
+    {
+      const double fu = (1. - std::abs(w)) * (u < 0. ? -1. : 1.);
+      const double fw = (1. - std::abs(u)) * (w < 0. ? -1. : 1.);
+      u = fu;
+      w = fw;
+    }
+
+    return {{ quantize(u), quantize(w) }};
+  }
+
+  /// returns the unit vector of encoding `e`.
+  static Vector decode(const Encoded& e)
+  {
+    if (e[0] == (std::numeric_limits<Integer>::min)())
+      return Vector(FT(0), FT(0), FT(0));
+
+    const double max = double((std::numeric_limits<Integer>::max)());
+    double u = e[0] / max, w = e[1] / max;
+    const double z = 1. - std::abs(u) - std::abs(w);
+    if (z < 0.)
+    {
+      const double fu = (1. - std::abs(w)) * (u < 0. ? -1. : 1.);
+      const double fw = (1. - std::abs(u)) * (w < 0. ? -1. : 1.);
+      u = fu;
+      w = fw;
+    }
+
+    const double norm = std::sqrt(u * u + w * w + z * z);
+    return Vector(FT(u / norm), FT(w / norm), FT(z / norm));
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  friend value_type get(const Octahedral_normal_map& map, const key_type& k)
+  {
+    return decode(get(map.m_map, k));
+  }
+
+  friend void put(const Octahedral_normal_map& map, const key_type& k, const value_type& v)
+  {
+    put(map.m_map, k, encode(v));
+  }
+  /// \endcond
+
+private:
+
+  static Integer quantize(double d)
+  {
+    const double max = double((std::numeric_limits<Integer>::max)());
+    return Integer(std::lround((std::min)(1., (std::max)(-1., d)) * max));
+  }
+
+  PropertyMap m_map;
+};
+
+/*!
+  \ingroup PkgPointSet3Ref
+
+  \brief Property map storing 3D points as integer coordinates on a
+  regular grid of step `step()` whose point of coordinates `(0, 0, 0)`
+  is `origin()`.
+
+  Point clouds are typically processed by tiles: with the origin of
+  the grid in the tile and `std::int16_t` or `std::int32_t`
+  coordinates, a point takes 6 or 12 bytes instead of 24, with a
+  maximum error of `step()/2` on each coordinate.
+
+  \tparam Point a model of `Kernel::Point_3`
+  \tparam PropertyMap a model of `ReadWritePropertyMap` whose value type
+  is `std::array<Integer, 3>`, where `Integer` is an integer type
+
+  \cgalModels{ReadWritePropertyMap}
+*/
+template <typename Point, typename PropertyMap>
+class Quantized_point_map
+{
+public:
+
+  /// \cond SKIP_IN_MANUAL
+  typedef typename boost::property_traits<PropertyMap>::key_type key_type;
+  typedef Point value_type;
+  typedef value_type reference;
+  typedef boost::read_write_property_map_tag category;
+
+  typedef typename boost::property_traits<PropertyMap>::value_type Encoded;
+  typedef typename Encoded::value_type Integer;
+  static_assert(std::is_integral<Integer>::value,
+                "Quantized_point_map requires integers.");
+  typedef typename Kernel_traits<Point>::Kernel::FT FT;
+  /// \endcond
+
+  /// \cond SKIP_IN_MANUAL
+  Quantized_point_map() : m_origin{{0., 0., 0.}}, m_step(1.) { }
+  /// \endcond
+
+  /// constructs a map that stores the points in `map`, on the grid of
+  /// origin `origin` and of step `step`.
+  Quantized_point_map(PropertyMap map, const Point& origin, double step)
+    : m_map(map),
+      m_origin{{ CGAL::to_double(origin.x()), CGAL::to_double(origin.y()), CGAL::to_double(origin.z()) }},
+      m_step(step)
+  {
+    CGAL_precondition(step > 0.);
+  }
+
+  /// constructs a map that stores the points in `map`, on the finest
+  /// grid such that all the points of `bbox` can be represented.
+  Quantized_point_map(PropertyMap map, const Bbox_3& bbox)
+    : m_map(map)
+  {
+    const double range = double((std::numeric_limits<Integer>::max)())
+                         - double((std::numeric_limits<Integer>::lowest)());
+    const double extent = (std::max)({ bbox.xmax() - bbox.xmin(),
+                                       bbox.ymax() - bbox.ymin(),
+                                       bbox.zmax() - bbox.zmin() });
+    m_step = (extent > 0. ? extent / range : 1.);
+    for (int i = 0; i < 3; ++ i)
+      m_origin[i] = bbox.min(i) - double((std::numeric_limits<Integer>::lowest)()) * m_step;
+  }
+
+  /// returns the underlying property map.
+  const PropertyMap& property_map() const { return m_map; }
+
+  /// returns the point of integer coordinates `(0, 0, 0)`.
+  Point origin() const { return Point(FT(m_origin[0]), FT(m_origin[1]), FT(m_origin[2])); }
+
+  /// returns the step of the grid.
+  double step() const { return m_step; }
+
+  /// returns the integer coordinates of the grid point nearest to `p`.
+  /// \pre the coordinates are in the range of `Integer`.
+  Encoded encode(const Point& p) const
+  {
+    return {{ quantize(CGAL::to_double(p.x()), 0),
+              quantize(CGAL::to_double(p.y()), 1),
+              quantize(CGAL::to_double(p.z()), 2) }};
+  }
+
+  /// returns the grid point of integer coordinates `e`.
+  Point decode(const Encoded& e) const
+  {
+    return Point(FT(m_origin[0] + m_step * double(e[0])),
+                 FT(m_origin[1] + m_step * double(e[1])),
+                 FT(m_origin[2] + m_step * double(e[2])));
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  friend value_type get(const Quantized_point_map& map, const key_type& k)
+  {
+    return map.decode(get(map.m_map, k));
+  }
+
+  friend void put(const Quantized_point_map& map, const key_type& k, const value_type& p)
+  {
+    put(map.m_map, k, map.encode(p));
+  }
+  /// \endcond
+
+private:
+
+  Integer quantize(double d, int i) const
+  {
+    const double q = std::round((d - m_origin[i]) / m_step);
+    const double lowest = double((std::numeric_limits<Integer>::lowest)());
+    const double max = double((std::numeric_limits<Integer>::max)());
+    CGAL_precondition(q >= lowest && q <= max);
+    return Integer((std::min)(max, (std::max)(lowest, q)));
+  }
+
+  PropertyMap m_map;
+  std::array<double, 3> m_origin;
+  double m_step;
+};
+
+/*!
+  \ingroup PkgPointSet3Ref
+
+  \brief Property map storing 3D points or vectors with three
+  `Half_float` coordinates.
+
+  A point or a vector takes 6 bytes instead of 24, with a relative
+  error below \f$ 2^{-11} \f$ on each coordinate. It is well suited to
+  normals, to colors or intensities stored as vectors, and to
+  coordinates relative to a nearby origin.
+
+  \tparam GeomObject `Kernel::Point_3` or `Kernel::Vector_3`
+  \tparam PropertyMap a model of `ReadWritePropertyMap` whose value type
+  is `std::array<Half_float, 3>`
+
+  \cgalModels{ReadWritePropertyMap}
+*/
+template <typename GeomObject, typename PropertyMap>
+class Half_float_map
+{
+public:
+
+  /// \cond SKIP_IN_MANUAL
+  typedef typename boost::property_traits<PropertyMap>::key_type key_type;
+  typedef GeomObject value_type;
+  typedef value_type reference;
+  typedef boost::read_write_property_map_tag category;
+
+  typedef std::array<Half_float, 3> Encoded;
+  typedef typename Kernel_traits<GeomObject>::Kernel::FT FT;
+  /// \endcond
+
+  /// constructs a map that stores the objects in `map`.
+  Half_float_map(PropertyMap map = PropertyMap()) : m_map(map) { }
+
+  /// returns the underlying property map.
+  const PropertyMap& property_map() const { return m_map; }
+
+  /// returns the coordinates of `o` rounded to `Half_float`.
+  static Encoded encode(const GeomObject& o)
+  {
+    return {{ Half_float(float(CGAL::to_double(o.x()))),
+              Half_float(float(CGAL::to_double(o.y()))),
+              Half_float(float(CGAL::to_double(o.z()))) }};
+  }
+
+  /// returns the object of coordinates `e`.
+  static GeomObject decode(const Encoded& e)
+  {
+    return GeomObject(FT(float(e[0])), FT(float(e[1])), FT(float(e[2])));
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  friend value_type get(const Half_float_map& map, const key_type& k)
+  {
+    return decode(get(map.m_map, k));
+  }
+
+  friend void put(const Half_float_map& map, const key_type& k, const value_type& o)
+  {
+    put(map.m_map, k, encode(o));
+  }
+  /// \endcond
+
+private:
+
+  PropertyMap m_map;
+};
+
+/// \ingroup PkgPointSet3Ref
+/// returns `Octahedral_normal_map<Vector, PropertyMap>(map)`.
+template <typename Vector, typename PropertyMap>
+Octahedral_normal_map<Vector, PropertyMap>
+make_octahedral_normal_map(PropertyMap map)
+{
+  return Octahedral_normal_map<Vector, PropertyMap>(map);
+}
+
+/// \ingroup PkgPointSet3Ref
+/// returns `Quantized_point_map<Point, PropertyMap>(map, bbox)`.
+template <typename Point, typename PropertyMap>
+Quantized_point_map<Point, PropertyMap>
+make_quantized_point_map(PropertyMap map, const Bbox_3& bbox)
+{
+  return Quantized_point_map<Point, PropertyMap>(map, bbox);
+}
+
+/// \ingroup PkgPointSet3Ref
+/// returns `Half_float_map<GeomObject, PropertyMap>(map)`.
+template <typename GeomObject, typename PropertyMap>
+Half_float_map<GeomObject, PropertyMap>
+make_half_float_map(PropertyMap map)
+{
+  return Half_float_map<GeomObject, PropertyMap>(map);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_POINT_SET_3_COMPACT_PROPERTY_MAPS_H
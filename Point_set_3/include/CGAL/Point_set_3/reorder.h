@@ -0,0 +1,93 @@
+// Copyright (c) 2026  GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_POINT_SET_3_REORDER_H
+#define CGAL_POINT_SET_3_REORDER_H
+
+#include <CGAL/license/Point_set_3.h>
+
+#include <CGAL/Point_set_3.h>
+
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+namespace CGAL {
+
+/*!
+  \ingroup PkgPointSet3Ref
+
+  \brief reorders the points of `point_set`, and all their properties,
+  along a Hilbert curve, so that points which are close in space are
+  also close in memory.
+
+  This improves the locality of the memory accesses of the algorithms
+  visiting the neighbors of the points, such as the construction and
+  the queries of a kd-tree. The points marked as removed are erased
+  (see `Point_set_3::collect_garbage()`).
+
+  \tparam Point the point type of the point set
+  \tparam Vector the vector type of the point set
+  \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  \param point_set the point set to reorder
+  \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the sort and the permutation of the properties should be done in parallel}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a model of `SpatialSortingTraits_3`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  \attention The points get new indices.
+*/
+template <typename Point, typename Vector,
+          typename NamedParameters = parameters::Default_named_parameters>
+void reorder_spatially (Point_set_3<Point, Vector>& point_set,
+                        const NamedParameters& np = parameters::default_values())
+{
+  typedef Point_set_3<Point, Vector>                          Point_set;
+
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                        NamedParameters,
+                                                        Sequential_tag>::type Concurrency_tag;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::geom_traits_t,
+                                                        NamedParameters,
+                                                        typename Kernel_traits<Point>::Kernel>::type GT;
+  const GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+
+  typedef Spatial_sort_traits_adapter_3<GT, typename Point_set::Point_map> Search_traits;
+
+  // sort the range of indices, then apply its order to the properties
+  hilbert_sort<Concurrency_tag> (point_set.begin(), point_set.end(),
+                                 Search_traits (point_set.point_map(), gt));
+  point_set.template collect_garbage<Concurrency_tag>();
+}
+
+} // namespace CGAL
+
+#endif // CGAL_POINT_SET_3_REORDER_H
@@ -127,6 +127,18 @@ int main (int, char**)
 
   test (p_before == p_after, "points should not change when clearing properties.");
 
+  Point_set::Huge_page_memory_resource resource;
+  point_set.add_property_map<int> ("label", 1);
+  point_set.set_memory_resource (&resource);
+  test (point_set.memory_resource() == &resource, "point set should use the memory resource.");
+  test (*(point_set.points().begin()) == p_after, "points should not change when changing the memory resource.");
+  test (point_set.property_map<int>("label").value()[*(point_set.begin())] == 1,
+        "properties should not change when changing the memory resource.");
+  point_set.clear_properties();
+  point_set.insert (Point (0, 0, 0));
+  test (point_set.memory_resource() == &resource, "point set should still use the memory resource.");
+  point_set.set_memory_resource (nullptr);
+
   std::unordered_set<Point_set::Index> std_hash;
   boost::unordered_set<Point_set::Index> boost_hash;
 
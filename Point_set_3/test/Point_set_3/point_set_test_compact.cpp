@@ -0,0 +1,164 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/compact_property_maps.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+
+typedef CGAL::Point_set_3<Point> Point_set;
+
+typedef std::array<std::int16_t, 2> Octahedral_normal;
+typedef std::array<std::int32_t, 3> Quantized_point;
+typedef std::array<CGAL::Half_float, 3> Half_vector;
+
+void test_half_float()
+{
+  // exactly representable values
+  for (float f : { 0.f, 1.f, -2.f, 0.5f, 1024.f, 65504.f, -0.25f, 6.103515625e-05f, 5.960464477539063e-08f })
+    assert (float(CGAL::Half_float(f)) == f);
+
+  assert (CGAL::Half_float(1.f).bits() == 0x3c00);
+  assert (CGAL::Half_float(-2.f).bits() == 0xc000);
+  assert (std::signbit(float(CGAL::Half_float(-0.f))));
+
+  // rounding to nearest, ties to even
+  assert (float(CGAL::Half_float(1.f + 1.f / 4096.f)) == 1.f);
+  assert (float(CGAL::Half_float(1.f + 3.f / 2048.f)) == 1.f + 2.f / 1024.f);
+  assert (float(CGAL::Half_float(65519.f)) == 65504.f);
+
+  // overflow, underflow, and special values
+  assert (float(CGAL::Half_float(65520.f)) == std::numeric_limits<float>::infinity());
+  assert (float(CGAL::Half_float(-1e10f)) == -std::numeric_limits<float>::infinity());
+  assert (float(CGAL::Half_float(1e-10f)) == 0.f);
+  assert (float(CGAL::Half_float(std::numeric_limits<float>::infinity())) == std::numeric_limits<float>::infinity());
+  assert (std::isnan(float(CGAL::Half_float(std::numeric_limits<float>::quiet_NaN()))));
+
+  // relative error
+  CGAL::Random rnd(0);
+  for (int i = 0; i < 10000; ++ i)
+  {
+    const float f = float(rnd.get_double(-1000., 1000.));
+    assert (std::abs(float(CGAL::Half_float(f)) - f) <= std::abs(f) / 2048.f);
+  }
+
+  // all the finite values convert back to themselves
+  for (std::uint32_t b = 0; b < 0x10000; ++ b)
+  {
+    const CGAL::Half_float h = CGAL::Half_float::from_bits(std::uint16_t(b));
+    if (std::isfinite(float(h)))
+      assert (CGAL::Half_float(float(h)).bits() == h.bits());
+  }
+}
+
+void test_octahedral()
+{
+  typedef CGAL::Octahedral_normal_map<Vector, Point_set::Property_map<Octahedral_normal> > Normal_map;
+
+  Point_set point_set;
+  CGAL::Random rnd(0);
+  CGAL::Random_points_on_sphere_3<Point> generator(1., rnd);
+  for (int i = 0; i < 10000; ++ i)
+    point_set.insert (*(generator ++));
+
+  Normal_map normals = CGAL::make_octahedral_normal_map<Vector>
+    (point_set.add_property_map<Octahedral_normal>("octahedral_normal").first);
+
+  double max_angle = 0.;
+  for (Point_set::Index idx : point_set)
+  {
+    const Vector n = point_set.point(idx) - CGAL::ORIGIN;
+    put (normals, idx, 3. * n);
+    const Vector d = get (normals, idx);
+    assert (std::abs(d.squared_length() - 1.) < 1e-12);
+    max_angle = (std::max)(max_angle, std::acos((std::min)(1., d * n / std::sqrt(n.squared_length()))));
+  }
+  std::cout << "Max angular error of octahedral normals: " << max_angle << std::endl;
+  assert (max_angle < 1e-4);
+
+  // the axes and the null vector
+  for (const Vector& v : { Vector(1, 0, 0), Vector(0, -1, 0), Vector(0, 0, 1), Vector(0, 0, -1) })
+    assert (Normal_map::decode (Normal_map::encode (v)) == v);
+  assert (Normal_map::decode (Normal_map::encode (CGAL::NULL_VECTOR)) == CGAL::NULL_VECTOR);
+}
+
+void test_quantized()
+{
+  typedef CGAL::Quantized_point_map<Point, Point_set::Property_map<Quantized_point> > Point_map;
+
+  Point_set point_set;
+  CGAL::Random rnd(0);
+  CGAL::Random_points_in_cube_3<Point> generator(1., rnd);
+  for (int i = 0; i < 10000; ++ i)
+    point_set.insert (Point(1000, 2000, 3000) + (*(generator ++) - CGAL::ORIGIN));
+
+  CGAL::Bbox_3 bbox = CGAL::bbox_3 (point_set.points().begin(), point_set.points().end());
+  Point_map quantized = CGAL::make_quantized_point_map<Point>
+    (point_set.add_property_map<Quantized_point>("quantized_point").first, bbox);
+
+  for (Point_set::Index idx : point_set)
+  {
+    put (quantized, idx, point_set.point(idx));
+    const Point q = get (quantized, idx);
+    for (int i = 0; i < 3; ++ i)
+      assert (std::abs(q[i] - point_set.point(idx)[i]) <= quantized.step());
+  }
+
+  // algorithms can use the quantized points
+  const double spacing = CGAL::compute_average_spacing<CGAL::Sequential_tag> (point_set, 6);
+  const double quantized_spacing = CGAL::compute_average_spacing<CGAL::Sequential_tag>
+    (point_set, 6, CGAL::parameters::point_map (quantized));
+  assert (std::abs(spacing - quantized_spacing) < 1e-6);
+
+  // with an explicit grid
+  Point_map coarse (quantized.property_map(), Point(1000, 2000, 3000), 0.01);
+  put (coarse, *(point_set.begin()), Point(1000.123, 1999.996, 3000.));
+  assert (get (quantized.property_map(), *(point_set.begin())) == (Quantized_point{{ 12, 0, 0 }}));
+}
+
+void test_half_float_map()
+{
+  typedef CGAL::Half_float_map<Vector, Point_set::Property_map<Half_vector> > Vector_map;
+
+  Point_set point_set;
+  point_set.add_normal_map();
+  CGAL::Random rnd(0);
+  CGAL::Random_points_on_sphere_3<Point> generator(1., rnd);
+  for (int i = 0; i < 1000; ++ i)
+  {
+    const Point p = *(generator ++);
+    point_set.insert (p, p - CGAL::ORIGIN);
+  }
+
+  Vector_map normals = CGAL::make_half_float_map<Vector>
+    (point_set.add_property_map<Half_vector>("half_normal").first);
+
+  for (Point_set::Index idx : point_set)
+  {
+    put (normals, idx, point_set.normal(idx));
+    const Vector d = get (normals, idx) - point_set.normal(idx);
+    assert (std::abs(d.x()) < 1e-3 && std::abs(d.y()) < 1e-3 && std::abs(d.z()) < 1e-3);
+  }
+}
+
+int main (int, char**)
+{
+  test_half_float();
+  test_octahedral();
+  test_quantized();
+  test_half_float_map();
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/reorder.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+
+typedef CGAL::Point_set_3<Point> Point_set;
+
+// random points with normals and an id, a third of them removed
+Point_set make_point_set (std::size_t nb_pts, unsigned int seed)
+{
+  Point_set point_set (true);
+  Point_set::Property_map<std::size_t> id = point_set.add_property_map<std::size_t>("id").first;
+
+  CGAL::Random rnd (seed);
+  CGAL::Random_points_in_cube_3<Point> generator (1., rnd);
+  for (std::size_t i = 0; i < nb_pts; ++ i)
+  {
+    const Point p = *(generator ++);
+    Point_set::iterator it = point_set.insert (p, p - CGAL::ORIGIN);
+    id[*it] = i;
+  }
+
+  std::vector<Point_set::Index> to_remove;
+  for (Point_set::Index idx : point_set)
+    if (id[idx] % 3 == 1)
+      to_remove.push_back (idx);
+  for (const Point_set::Index& idx : to_remove)
+    point_set.remove (idx);
+
+  return point_set;
+}
+
+void check_properties (const Point_set& point_set)
+{
+  assert (!point_set.has_garbage());
+  Point_set::Property_map<std::size_t> id = point_set.property_map<std::size_t>("id").value();
+  std::size_t i = 0;
+  for (Point_set::Index idx : point_set)
+  {
+    assert (std::size_t(idx) == i ++);
+    assert (point_set.normal(idx) == point_set.point(idx) - CGAL::ORIGIN);
+    assert (id[idx] % 3 != 1);
+  }
+}
+
+void compare (const Point_set& a, const Point_set& b)
+{
+  assert (a.size() == b.size());
+  Point_set::Property_map<std::size_t> ida = a.property_map<std::size_t>("id").value();
+  Point_set::Property_map<std::size_t> idb = b.property_map<std::size_t>("id").value();
+  for (std::size_t i = 0; i < a.size(); ++ i)
+  {
+    assert (a.point(Point_set::Index(i)) == b.point(Point_set::Index(i)));
+    assert (ida[Point_set::Index(i)] == idb[Point_set::Index(i)]);
+  }
+}
+
+// sum of the distances between consecutive points in memory
+double path_length (const Point_set& point_set)
+{
+  double length = 0.;
+  for (std::size_t i = 1; i < point_set.size(); ++ i)
+    length += CGAL::approximate_sqrt (CGAL::squared_distance (point_set.point(Point_set::Index(i - 1)),
+                                                              point_set.point(Point_set::Index(i))));
+  return length;
+}
+
+int main (int, char**)
+{
+  // parallel garbage collection gives the same result as the sequential one
+  {
+    Point_set seq = make_point_set (10000, 0), par = seq;
+    seq.collect_garbage();
+    par.collect_garbage<CGAL::Parallel_if_available_tag>();
+    check_properties (seq);
+    check_properties (par);
+    compare (seq, par);
+
+    // the point set can still be modified
+    par.insert (Point (2, 2, 2), Vector (2, 2, 2));
+    assert (par.size() == seq.size() + 1);
+  }
+
+  // parallel join
+  {
+    Point_set seq = make_point_set (10000, 0), other = make_point_set (5000, 1);
+    Point_set par = seq, par_other = other;
+    const std::size_t size = seq.size() + other.size();
+    seq.join (other);
+    par.join<CGAL::Parallel_if_available_tag> (par_other);
+    assert (par.size() == size);
+    check_properties (seq);
+    check_properties (par);
+    compare (seq, par);
+  }
+
+  // sorting the range of indices then collecting the garbage applies the order
+  {
+    Point_set point_set = make_point_set (1000, 2);
+    std::sort (point_set.begin(), point_set.end(),
+               [&](const Point_set::Index& a, const Point_set::Index& b)
+               { return point_set.point(a).x() < point_set.point(b).x(); });
+    point_set.collect_garbage<CGAL::Parallel_if_available_tag>();
+    check_properties (point_set);
+    for (std::size_t i = 1; i < point_set.size(); ++ i)
+      assert (point_set.point(Point_set::Index(i - 1)).x() <= point_set.point(Point_set::Index(i)).x());
+  }
+
+  // spatial reordering
+  {
+    Point_set seq = make_point_set (10000, 3), par = seq;
+    const std::size_t size = seq.size();
+    const double length = path_length (make_point_set (10000, 3));
+
+    CGAL::reorder_spatially (seq);
+    CGAL::reorder_spatially (par, CGAL::parameters::concurrency_tag (CGAL::Parallel_if_available_tag()));
+    check_properties (seq);
+    check_properties (par);
+    assert (seq.size() == size && par.size() == size);
+    compare (seq, par);
+
+    std::cout << "Path length: " << length << " -> " << path_length (seq) << std::endl;
+    assert (path_length (seq) < length / 4.);
+  }
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
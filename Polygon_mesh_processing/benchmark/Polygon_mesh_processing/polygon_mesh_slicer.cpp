@@ -20,7 +20,9 @@
 #include <functional>
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 
+#include <cstdlib>
 #include <fstream>
+#include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
 typedef K::Point_3 Point_3;
@@ -92,7 +94,7 @@ int main(int argc, char* argv[])
 {
   std::ifstream input(argv[1]);
   Mesh m;
-  int N = 100;
+  int N = (argc > 2) ? std::atoi(argv[2]) : 100;
   if (!input || !(input >> m)){
     std::cerr << "Error: can not read file.\n";
     return 1;
@@ -134,5 +136,24 @@ int main(int argc, char* argv[])
   std::cerr << N << " layers in a model with " << num_faces(m) << " triangles"<< std::endl;
   std::cerr << polycount << " polylines with in total " << vertex_count << " vertices computed in "<< t.time() << " sec." << std::endl;
 
+  // all the planes at once
+  std::vector<K::Plane_3> planes;
+  for(int i=0; i < N; i++)
+    planes.push_back(K::Plane_3(Point_3(0,0,zmin+delta*i), Vector_3(0,0,1)));
+
+  std::vector<std::vector<Polyline> > all_polylines;
+  t.reset();
+  t.start();
+  slicer(planes, std::back_inserter(all_polylines));
+  t.stop();
+  std::cerr << "all planes at once (sequential): " << t.time() << " sec." << std::endl;
+
+  all_polylines.clear();
+  t.reset();
+  t.start();
+  slicer.operator()<CGAL::Parallel_if_available_tag>(planes, std::back_inserter(all_polylines));
+  t.stop();
+  std::cerr << "all planes at once (parallel): " << t.time() << " sec." << std::endl;
+
   return 0;
 }
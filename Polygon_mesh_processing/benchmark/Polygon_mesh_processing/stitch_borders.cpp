@@ -0,0 +1,72 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/stitch_borders.h>
+#include <CGAL/Polygon_mesh_processing/merge_border_vertices.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+typedef CGAL::Surface_mesh<Point_3>                         Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+namespace params = CGAL::parameters;
+
+// Stitches a grid made of `nb_tiles x nb_tiles` independent tiles,
+// as obtained from a tiled reconstruction.
+// Usage: stitch_borders [nb_tiles] [tile_size]
+// (for example, `stitch_borders 250 10` gives 2.5 millions border edges)
+int main(int argc, char** argv)
+{
+  const int nb_tiles = (argc > 1) ? std::atoi(argv[1]) : 100;
+  const int tile_size = (argc > 2) ? std::atoi(argv[2]) : 20;
+
+  Mesh tiles;
+  for(int tx=0; tx<nb_tiles; ++tx)
+    for(int ty=0; ty<nb_tiles; ++ty)
+      CGAL::make_grid(tile_size, tile_size, tiles,
+                      [&](int i, int j) { return Point_3(tx * tile_size + i, ty * tile_size + j, 0); },
+                      true /*triangulated*/);
+
+  std::cout << num_faces(tiles) << " faces, "
+            << 4 * nb_tiles * nb_tiles * tile_size << " border edges" << std::endl;
+
+  CGAL::Real_timer timer;
+
+  Mesh mesh = tiles;
+  timer.start();
+  std::size_t res = PMP::stitch_borders(mesh);
+  timer.stop();
+  std::cout << "stitch_borders (sequential): " << res << " pairs stitched in " << timer.time() << " sec." << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  mesh = tiles;
+  timer.reset();
+  timer.start();
+  res = PMP::stitch_borders(mesh, params::concurrency_tag(CGAL::Parallel_tag()));
+  timer.stop();
+  std::cout << "stitch_borders (parallel): " << res << " pairs stitched in " << timer.time() << " sec." << std::endl;
+#endif
+
+  mesh = tiles;
+  timer.reset();
+  timer.start();
+  PMP::merge_duplicated_vertices_in_boundary_cycles(mesh);
+  timer.stop();
+  std::cout << "merge_duplicated_vertices_in_boundary_cycles (sequential): " << timer.time() << " sec." << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  mesh = tiles;
+  timer.reset();
+  timer.start();
+  PMP::merge_duplicated_vertices_in_boundary_cycles(mesh, params::concurrency_tag(CGAL::Parallel_tag()));
+  timer.stop();
+  std::cout << "merge_duplicated_vertices_in_boundary_cycles (parallel): " << timer.time() << " sec." << std::endl;
+#endif
+
+  return EXIT_SUCCESS;
+}
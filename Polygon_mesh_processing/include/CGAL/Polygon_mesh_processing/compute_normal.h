@@ -23,11 +23,19 @@
 #include <CGAL/boost/graph/properties.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/Origin.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <boost/graph/graph_traits.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 #include <iostream>
 #include <limits>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <unordered_map>
@@ -225,6 +233,13 @@ compute_face_normal(typename boost::graph_traits<PolygonMesh>::face_descriptor f
 *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
 *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the normals are computed concurrently and then written sequentially in the property map.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \warning This function involves a square root computation.
@@ -238,9 +253,37 @@ void compute_face_normals(const PolygonMesh& pmesh,
                           Face_normal_map face_normals,
                           const NamedParameters& np = parameters::default_values())
 {
+  typedef typename boost::graph_traits<PolygonMesh>::face_descriptor face_descriptor;
+
   typedef typename GetGeomTraits<PolygonMesh,NamedParameters>::type Kernel;
 
-  for(typename boost::graph_traits<PolygonMesh>::face_descriptor f : faces(pmesh))
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    const std::vector<face_descriptor> face_range(faces(pmesh).begin(), faces(pmesh).end());
+    std::vector<typename Kernel::Vector_3> normals(face_range.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, face_range.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          normals[i] = compute_face_normal(face_range[i], pmesh, np);
+                      });
+
+    // the map is not required to support concurrent writes
+    for(std::size_t i=0; i<face_range.size(); ++i)
+      put(face_normals, face_range[i], normals[i]);
+    return;
+  }
+#endif
+
+  for(face_descriptor f : faces(pmesh))
   {
     typename Kernel::Vector_3 vec = compute_face_normal(f, pmesh, np);
     put(face_normals, f, vec);
@@ -744,6 +787,35 @@ compute_vertex_normal(typename boost::graph_traits<PolygonMesh>::vertex_descript
   return normal;
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+namespace internal {
+
+// `np` must contain the face normals
+template <typename PolygonMesh, typename VertexNormalMap, typename NamedParameters>
+void compute_vertex_normals_in_parallel(const PolygonMesh& pmesh,
+                                        VertexNormalMap vertex_normals,
+                                        const NamedParameters& np)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor           vertex_descriptor;
+  typedef typename GetGeomTraits<PolygonMesh,NamedParameters>::type              GT;
+
+  // vertices are processed in the order of the mesh, by blocks of consecutive vertices
+  const std::vector<vertex_descriptor> vertex_range(vertices(pmesh).begin(), vertices(pmesh).end());
+  std::vector<typename GT::Vector_3> normals(vertex_range.size());
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_range.size()),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+                    {
+                      for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                        normals[i] = compute_vertex_normal(vertex_range[i], pmesh, np);
+                    });
+
+  // the map is not required to support concurrent writes
+  for(std::size_t i=0; i<vertex_range.size(); ++i)
+    put(vertex_normals, vertex_range[i], normals[i]);
+}
+
+} // namespace internal
+#endif
 
 /**
 * \ingroup PMP_normal_grp
@@ -775,6 +847,13 @@ compute_vertex_normal(typename boost::graph_traits<PolygonMesh>::vertex_descript
 *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
 *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the normals are computed concurrently and then written sequentially in the property map.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \warning This function involves a square root computation.
@@ -815,6 +894,36 @@ void compute_vertex_normals(const PolygonMesh& pmesh,
                                                   get(Face_normal_tag(), pmesh));
   const bool must_compute_face_normals = is_default_parameter<NamedParameters, internal_np::face_normal_t>::value;
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type     Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    if(must_compute_face_normals)
+    {
+      // face normals are stored in a vector indexed by the faces, which can be read concurrently
+      typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type FIMap;
+      FIMap fimap = get_initialized_face_index_map(pmesh, np);
+
+      std::vector<Vector_3> face_normal_vector(num_faces(pmesh));
+      auto face_normal_vector_map = make_compose_property_map(fimap, make_property_map(face_normal_vector));
+      compute_face_normals(pmesh, face_normal_vector_map, np);
+      internal::compute_vertex_normals_in_parallel(pmesh, vertex_normals,
+                                                   np.face_normal_map(face_normal_vector_map));
+    }
+    else
+    {
+      internal::compute_vertex_normals_in_parallel(pmesh, vertex_normals, np);
+    }
+    return;
+  }
+#endif
+
   if(must_compute_face_normals)
     compute_face_normals(pmesh, face_normals, np);
 
@@ -872,6 +981,13 @@ void compute_vertex_normals(const PolygonMesh& pmesh,
 *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
 *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the normals are computed concurrently and then written sequentially in the property map.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \warning This function involves a square root computation.
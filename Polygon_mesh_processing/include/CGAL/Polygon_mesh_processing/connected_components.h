@@ -17,6 +17,7 @@
 
 #include <CGAL/disable_warnings.h>
 
+#include<limits>
 #include<set>
 #include<vector>
 
@@ -40,11 +41,68 @@
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <atomic>
+#endif
+
+#include <type_traits>
 
 namespace CGAL {
 namespace Polygon_mesh_processing{
 namespace internal {
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // A lock-free union-find on the integers `[0, n)`, whose sets can be merged concurrently.
+  // A root is always linked to a root of smaller index, so that the representative
+  // of a set is its smallest element once all the unions are done.
+  class Concurrent_union_find
+  {
+    std::vector<std::atomic<std::size_t> > parent;
+
+  public:
+    Concurrent_union_find(std::size_t n)
+      : parent(n)
+    {
+      tbb::parallel_for(std::size_t(0), n, [&](std::size_t i) { parent[i].store(i, std::memory_order_relaxed); });
+    }
+
+    std::size_t find(std::size_t i)
+    {
+      for(;;)
+      {
+        std::size_t p = parent[i].load();
+        if(p == i)
+          return i;
+        const std::size_t gp = parent[p].load();
+        // path halving
+        if(p != gp)
+          parent[i].compare_exchange_weak(p, gp);
+        i = gp;
+      }
+    }
+
+    void unite(std::size_t i, std::size_t j)
+    {
+      for(;;)
+      {
+        i = find(i);
+        j = find(j);
+        if(i == j)
+          return;
+        if(i < j)
+          std::swap(i, j);
+        std::size_t expected = i;
+        if(parent[i].compare_exchange_strong(expected, j))
+          return;
+      }
+    }
+  };
+#endif
+
   struct MoreSecond
   {
     template <typename T1, typename T2>
@@ -187,6 +245,14 @@ connected_component(typename boost::graph_traits<PolygonMesh>::face_descriptor s
  *                    as key type and `std::size_t` as value type}
  *     \cgalParamDefault{an automatically indexed internal map}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{In parallel, the faces are labeled using a concurrent union-find on the edges of `pmesh`.
+ *                     The components are numbered as in the sequential version.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \returns the number of connected components.
@@ -221,7 +287,59 @@ connected_components(const PolygonMesh& pmesh,
   typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type FaceIndexMap;
   FaceIndexMap fimap = get_initialized_face_index_map(pmesh, np);
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type Concurrency_tag;
+
   typename boost::property_traits<FaceComponentMap>::value_type i=0;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    const std::vector<face_descriptor> face_range(faces(pmesh).begin(), faces(pmesh).end());
+    const std::size_t nf = face_range.size();
+
+    // merge the sets of the faces on both sides of each unconstrained edge
+    internal::Concurrent_union_find uf(nf);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nf),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t fi=r.begin(); fi!=r.end(); ++fi)
+                        {
+                          const face_descriptor f = face_range[fi];
+                          const std::size_t f_id = get(fimap, f);
+                          for(halfedge_descriptor h : halfedges_around_face(halfedge(f, pmesh), pmesh))
+                          {
+                            const face_descriptor fo = face(opposite(h, pmesh), pmesh);
+                            if(fo == GT::null_face() || get(ecmap, edge(h, pmesh)))
+                              continue;
+                            const std::size_t fo_id = get(fimap, fo);
+                            if(f_id < fo_id) // each edge once
+                              uf.unite(f_id, fo_id);
+                          }
+                        }
+                      });
+
+    std::vector<std::size_t> roots(nf);
+    tbb::parallel_for(std::size_t(0), nf, [&](std::size_t fi) { roots[fi] = uf.find(get(fimap, face_range[fi])); });
+
+    // components are numbered in the order of the faces, as in the sequential version
+    const std::size_t no_id = (std::numeric_limits<std::size_t>::max)();
+    std::vector<std::size_t> component_ids(nf, no_id);
+    for(std::size_t fi=0; fi<nf; ++fi)
+    {
+      std::size_t& id = component_ids[roots[fi]];
+      if(id == no_id)
+        id = i++;
+      put(fcm, face_range[fi], id);
+    }
+    return i;
+  }
+#endif
+
   std::vector<bool> handled(num_faces(pmesh), false);
   for (face_descriptor f : faces(pmesh))
   {
@@ -375,6 +493,13 @@ std::size_t number_of_connected_components(const PolygonMesh& pmesh,
  *     \cgalParamType{a model of `OutputIterator` with value type `face_descriptor`}
  *     \cgalParamDefault{unused}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{The connected components are computed with `connected_components()`.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \return the number of connected components removed (ignoring isolated vertices).
@@ -525,6 +650,13 @@ std::size_t keep_largest_connected_components(PolygonMesh& pmesh,
  *     \cgalParamType{a model of `OutputIterator` with value type `face_descriptor`}
  *     \cgalParamDefault{unused}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{The connected components are computed with `connected_components()`.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \return the number of connected components removed (ignoring isolated vertices).
@@ -21,18 +21,41 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Weights/cotangent_weights.h>
+#include <CGAL/tags.h>
 
 #if defined(CGAL_EIGEN3_ENABLED)
 #include <CGAL/Eigen_solver_traits.h>  // for sparse linear system solver
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <iterator>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CGAL {
 
 namespace Polygon_mesh_processing {
 
 namespace internal {
+
+#if defined(CGAL_EIGEN3_ENABLED)
+  #if EIGEN_VERSION_AT_LEAST(3,2,0)
+  typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
+    CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> >  >
+    Default_fair_solver;
+  #else
+  typedef bool Default_fair_solver;//compilation should crash
+    //if no solver is provided and Eigen version < 3.2
+  #endif
+#else
+  typedef bool Default_fair_solver;//compilation should crash
+    //if no solver is provided and Eigen version < 3.2
+#endif
+
   // use non-default weight calculator and non-default solver
   // WeightCalculator a model of `FairWeightCalculator`, can be omitted to use default Cotangent weights
   // weight_calculator a function object to calculate weights, defaults to Cotangent weights and can be omitted
@@ -54,6 +77,89 @@ bool fair(TriangleMesh& tmesh,
   return fair_functor.fair(vertices, solver, continuity);
 }
 
+  // fairs independently each range of vertices of `vertex_ranges` and returns the number
+  // of successful fairings. The new positions of all the ranges are computed from the
+  // positions of the vertices before any of them is moved, so that, with `Parallel_tag`,
+  // the linear systems are built and solved concurrently. In that case, each system is
+  // solved with its own default constructed instance of the solver type of `np`,
+  // as copies of a solver may share their factorization.
+  template<typename ConcurrencyTag,
+           typename TriangleMesh,
+           typename VertexRanges,
+           typename NamedParameters>
+  std::size_t fair_vertex_ranges(TriangleMesh& tmesh,
+                                 const VertexRanges& vertex_ranges,
+                                 const NamedParameters& np)
+  {
+    using parameters::get_parameter;
+    using parameters::choose_parameter;
+
+    typedef typename GetSolver<NamedParameters, Default_fair_solver>::type Solver;
+    static_assert(!std::is_same<Solver, bool>::value,
+                  "The function `fair` requires Eigen3 version 3.2 or later.");
+
+    typedef typename GetVertexPointMap<TriangleMesh, NamedParameters>::type VPMap;
+    typedef typename GetGeomTraits<TriangleMesh, NamedParameters>::type GT;
+    typedef typename boost::property_traits<VPMap>::value_type Point;
+    typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor vertex_descriptor;
+    typedef CGAL::Weights::Secure_cotangent_weight_with_voronoi_area<TriangleMesh, VPMap, GT> Default_weight_calculator;
+
+    VPMap vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                                   get_property_map(vertex_point, tmesh));
+    GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+    const auto weight_calculator = choose_parameter(get_parameter(np, internal_np::weight_calculator),
+                                                    Default_weight_calculator(tmesh, vpmap, gt));
+    const unsigned int continuity = choose_parameter(get_parameter(np, internal_np::fairing_continuity), 1);
+
+    typedef Fair_Polyhedron_3<TriangleMesh, Solver, std::remove_const_t<decltype(weight_calculator)>, VPMap> Fairer;
+
+    const std::size_t nb_ranges = std::distance(std::begin(vertex_ranges), std::end(vertex_ranges));
+    std::vector<std::vector<std::pair<vertex_descriptor, Point> > > positions(nb_ranges);
+    std::vector<char> success(nb_ranges, 0);
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      typedef typename std::iterator_traits<decltype(std::begin(vertex_ranges))>::value_type Vertex_range;
+      std::vector<const Vertex_range*> ranges;
+      ranges.reserve(nb_ranges);
+      for(const Vertex_range& vr : vertex_ranges)
+        ranges.push_back(&vr);
+
+      tbb::parallel_for(std::size_t(0), nb_ranges, [&](std::size_t i)
+      {
+        Fairer fairer(tmesh, vpmap, weight_calculator);
+        success[i] = fairer.compute_fair_positions(*ranges[i], Solver(), continuity, positions[i]);
+      });
+    }
+    else
+#endif
+    {
+      const Solver solver = choose_parameter<Default_fair_solver>(get_parameter(np, internal_np::sparse_linear_solver));
+      std::size_t i = 0;
+      for(const auto& vr : vertex_ranges)
+      {
+        Fairer fairer(tmesh, vpmap, weight_calculator);
+        success[i] = fairer.compute_fair_positions(vr, solver, continuity, positions[i]);
+        ++i;
+      }
+    }
+
+    std::size_t nb_success = 0;
+    for(std::size_t i=0; i<nb_ranges; ++i)
+    {
+      if(!success[i])
+        continue;
+      ++nb_success;
+      for(const std::pair<vertex_descriptor, Point>& vp : positions[i])
+        put(vpmap, vp.first, vp.second);
+    }
+    return nb_success;
+  }
+
 } //end namespace internal
 
   /*!
@@ -136,19 +242,7 @@ bool fair(TriangleMesh& tmesh,
 
     CGAL_precondition(is_triangle_mesh(tmesh));
 
-#if defined(CGAL_EIGEN3_ENABLED)
-  #if EIGEN_VERSION_AT_LEAST(3,2,0)
-    typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
-      CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> >  >
-      Default_solver;
-  #else
-    typedef bool Default_solver;//compilation should crash
-      //if no solver is provided and Eigen version < 3.2
-  #endif
-#else
-    typedef bool Default_solver;//compilation should crash
-      //if no solver is provided and Eigen version < 3.2
-#endif
+    typedef internal::Default_fair_solver Default_solver;
 
 #if defined(CGAL_EIGEN3_ENABLED)
     static_assert(
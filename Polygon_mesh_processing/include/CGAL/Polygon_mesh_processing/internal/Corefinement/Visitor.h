@@ -25,10 +25,20 @@
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Projection_traits_3.h>
 #include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
 namespace CGAL{
 namespace Polygon_mesh_processing {
 namespace Corefinement{
@@ -440,7 +450,8 @@ template< class TriangleMesh,
           class EdgeMarkMapBind_ = Default,
           class UserVisitor_ = Default,
           bool doing_autorefinement = false,
-          bool handle_non_manifold_features = false >
+          bool handle_non_manifold_features = false,
+          class ConcurrencyTag = Sequential_tag >
 class Surface_intersection_visitor_for_corefinement{
 //default template parameters
   typedef typename Default::Get<EdgeMarkMapBind_,
@@ -1188,6 +1199,215 @@ public:
     }
   }
 
+  // The data of the retriangulation of an intersected face that is obtained
+  // by reading the mesh only (see `triangulate_intersected_faces()`).
+  struct Face_triangulation
+  {
+    bool initialized = false;
+    // the vertices of f
+    std::array<vertex_descriptor,3> f_vertices;
+    // the node_id of an input vertex or a fake id (>=nb_nodes)
+    std::array<Node_id,3> f_indices;
+    //associate an edge of the triangulation to a halfedge in a given polyhedron
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
+    std::map<Node_id,CDT_Vertex_handle> id_to_CDT_vh;
+    std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+    std::unique_ptr<CDT> cdt;
+  };
+
+  void init_face_triangulation(face_descriptor f,
+                               typename Face_boundaries::iterator it_fb,
+                               const Face_boundaries& face_boundaries,
+                               const TriangleMesh& tm,
+                               Vertex_to_node_id& vertex_to_node_id,
+                               const Node_id nb_nodes,
+                               Face_triangulation& ft)
+  {
+    std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    std::array<Node_id,3>& f_indices = ft.f_indices;
+    f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
+    if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
+      f_vertices[0]=it_fb->second.vertices[0];
+      f_vertices[1]=it_fb->second.vertices[1];
+      f_vertices[2]=it_fb->second.vertices[2];
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+    }
+    else{
+      CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
+      halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
+      f_vertices[0]=target(h0,tm); //nb_nodes
+      f_vertices[1]=target(h1,tm); //nb_nodes+1
+      f_vertices[2]=target(h2,tm); //nb_nodes+2
+
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+      ft.edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
+      ft.edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
+      ft.edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+    }
+    ft.initialized = true;
+  }
+
+  template <class VPM>
+  bool is_degenerate_face(const Face_triangulation& ft, const VPM& vpm) const
+  {
+    return const_mesh_ptr && collinear( get(vpm,ft.f_vertices[0]),
+                                        get(vpm,ft.f_vertices[1]),
+                                        get(vpm,ft.f_vertices[2]) );
+  }
+
+  // Returns `true` if the triangulation of the face does not depend on the
+  // constraints coming from the intersection of coplanar faces, which are
+  // collected while faces are triangulated.
+  bool is_independent_face(const Face_triangulation& ft,
+                           typename Face_boundaries::iterator it_fb,
+                           const Face_boundaries& face_boundaries,
+                           const Node_ids& node_ids) const
+  {
+    auto is_coplanar_node = [this](Node_id id) { return id < number_coplanar_vertices; };
+    if (std::any_of(ft.f_indices.begin(), ft.f_indices.end(), is_coplanar_node) ||
+        std::any_of(node_ids.begin(), node_ids.end(), is_coplanar_node))
+      return false;
+    if (it_fb!=face_boundaries.end())
+      for (int i=0;i<3;++i)
+        if (std::any_of(it_fb->second.node_ids_array[i].begin(),
+                        it_fb->second.node_ids_array[i].end(), is_coplanar_node))
+          return false;
+    return true;
+  }
+
+  // Builds the constrained triangulation of the face. The mesh is not modified.
+  template <class VPM>
+  void build_face_triangulation(typename Face_boundaries::iterator it_fb,
+                                const Face_boundaries& face_boundaries,
+                                Node_ids& node_ids,
+                                const TriangleMesh& tm,
+                                const VPM& vpm,
+                                INodes& nodes,
+                                const Node_id nb_nodes,
+                                Face_triangulation& ft)
+  {
+    const std::array<Node_id,3>& f_indices = ft.f_indices;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+    std::map<Node_id,CDT_Vertex_handle>& id_to_CDT_vh = ft.id_to_CDT_vh;
+    std::vector<std::pair<Node_id,Node_id> >& constrained_edges = ft.constrained_edges;
+
+    typename EK::Point_3 p = nodes.to_exact(get(vpm,ft.f_vertices[0])),
+                         q = nodes.to_exact(get(vpm,ft.f_vertices[1])),
+                         r = nodes.to_exact(get(vpm,ft.f_vertices[2]));
+///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
+    CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
+    ft.cdt.reset(new CDT(traits));
+    CDT& cdt = *ft.cdt;
+
+    // insert triangle points
+    std::array<CDT_Vertex_handle,3> triangle_vertices;
+    //we can do this to_exact because these are supposed to be input points.
+    triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
+    triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
+    triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
+    triangle_vertices[2]->set_point(r);
+
+    triangle_vertices[0]->info()=f_indices[0];
+    triangle_vertices[1]->info()=f_indices[1];
+    triangle_vertices[2]->info()=f_indices[2];
+
+    //if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik){
+      if ( f_indices[ik]<nb_nodes )
+        id_to_CDT_vh.insert(
+            std::make_pair(f_indices[ik],triangle_vertices[ik]));
+    }
+    //insert points on edges
+    if (it_fb!=face_boundaries.end()) //if f not a triangle?
+    {
+      // collect infinite faces incident to the initial triangle
+      typename CDT::Face_handle infinite_faces[3];
+      for (int i=0;i<3;++i)
+      {
+        int oi=-1;
+        CGAL_assertion_code(bool is_edge = )
+        cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
+        CGAL_assertion(is_edge);
+        CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
+      }
+
+      // In this loop, for each original edge of the triangle, we insert
+      // the constrained edges and we recover the halfedge_descriptor
+      // corresponding to these constrained (they are already in tm)
+      const Face_boundary& f_boundary=it_fb->second;
+      for (int i=0;i<3;++i){
+        //handle case of halfedge starting at triangle_vertices[i]
+        // and ending at triangle_vertices[(i+1)%3]
+
+        const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
+        CDT_Vertex_handle previous=triangle_vertices[i];
+        Node_id prev_index=f_indices[i];// node-id of the mesh vertex
+        halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
+        CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
+        if (!ids_on_edge.empty()){ //is there at least one node on this edge?
+          // fh must be an infinite face
+          // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
+          for(Node_id id : ids_on_edge)
+          {
+            CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
+            vh->info()=id;
+            id_to_CDT_vh.insert(std::make_pair(id,vh));
+            edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
+            previous=vh;
+            hedge=next(hedge,tm);
+            prev_index=id;
+          }
+        }
+        else{
+        CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
+          CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
+          CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
+        }
+        CGAL_assertion(hedge==f_boundary.halfedges[i]);
+        edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
+          it_fb->second.halfedges[i];
+      }
+    }
+
+    //insert point inside face
+    for(Node_id node_id : node_ids)
+    {
+      CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
+      vh->info()=node_id;
+      id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    }
+
+    // insert constraints that are interior to the triangle (in the case
+    // no edges are collinear in the meshes)
+    insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
+
+    // insert constraints between points that are on the boundary
+    // (not a constrained on the triangle boundary)
+    if (it_fb!=face_boundaries.end()) //is f not a triangle ?
+    {
+      for (int i=0;i<3;++i)
+      {
+        Node_ids& ids=it_fb->second.node_ids_array[i];
+        insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
+      }
+    }
+
+    //insert coplanar edges for endpoints of triangles
+    for (int i=0;i<3;++i){
+      Node_id nindex=triangle_vertices[i]->info();
+      if ( nindex < nb_nodes )
+        insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+    }
+  }
+
+  // The faces are triangulated in two steps. First, the constrained triangulation
+  // of each face is built, which only reads the mesh. Second, the triangulation
+  // is imported in the mesh. With `Parallel_tag`, the first step is done
+  // concurrently by batches of faces, except for degenerate faces and for
+  // faces involving intersection points of coplanar faces (the constraints
+  // of such faces are collected from the faces triangulated before them).
+  // The faces are imported in the same order in both cases, so that
+  // the same triangles are created.
   template <class OnFaceMapIterator, class VPM>
   void triangulate_intersected_faces(OnFaceMapIterator it,
                                      const VPM& vpm,
@@ -1204,256 +1424,174 @@ public:
 
     const Node_id nb_nodes = nodes.size();
 
+    std::vector<typename On_face_map::iterator> faces_to_triangulate;
+    faces_to_triangulate.reserve(on_face_map.size());
     for (typename On_face_map::iterator it=on_face_map.begin();
           it!=on_face_map.end();++it)
+      faces_to_triangulate.push_back(it);
+
+    const std::size_t nb_faces = faces_to_triangulate.size();
+    const std::size_t batch_size =
+      std::is_convertible<ConcurrencyTag, Parallel_tag>::value ? 8192 : nb_faces;
+
+    for (std::size_t batch_begin=0; batch_begin<nb_faces; batch_begin+=batch_size)
+    {
+    const std::size_t batch_end = (std::min)(nb_faces, batch_begin+batch_size);
+    std::vector<Face_triangulation> face_triangulations(batch_end-batch_begin);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(batch_begin, batch_end),
+        [&](const tbb::blocked_range<std::size_t>& range)
+        {
+          for (std::size_t i=range.begin(); i!=range.end(); ++i)
+          {
+            typename On_face_map::iterator it=faces_to_triangulate[i];
+            typename Face_boundaries::iterator it_fb=face_boundaries.find(it->first);
+            Face_triangulation& ft=face_triangulations[i-batch_begin];
+            init_face_triangulation(it->first, it_fb, face_boundaries, tm,
+                                    vertex_to_node_id, nb_nodes, ft);
+            if (!is_degenerate_face(ft, vpm) &&
+                is_independent_face(ft, it_fb, face_boundaries, it->second))
+              build_face_triangulation(it_fb, face_boundaries, it->second, tm, vpm,
+                                       nodes, nb_nodes, ft);
+          }
+        });
+    }
+#endif
+
+    for (std::size_t i=batch_begin; i!=batch_end; ++i)
     {
+      typename On_face_map::iterator it=faces_to_triangulate[i];
       user_visitor.triangulating_faces_step();
       face_descriptor f = it->first; //the face to be triangulated
       Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
       typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
 
-      std::map<Node_id,typename CDT::Vertex_handle> id_to_CDT_vh;
-
-      //associate an edge of the triangulation to a halfedge in a given polyhedron
-      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
-
-      // the vertices of f
-      std::array<vertex_descriptor,3> f_vertices;
-      // the node_id of an input vertex or a fake id (>=nb_nodes)
-      std::array<Node_id,3> f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
-      if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
-        f_vertices[0]=it_fb->second.vertices[0];
-        f_vertices[1]=it_fb->second.vertices[1];
-        f_vertices[2]=it_fb->second.vertices[2];
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        if (doing_autorefinement || handle_non_manifold_features)
-          it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
-      }
-      else{
-        CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
-        halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
-        f_vertices[0]=target(h0,tm); //nb_nodes
-        f_vertices[1]=target(h1,tm); //nb_nodes+1
-        f_vertices[2]=target(h2,tm); //nb_nodes+2
-
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
-        edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
-        edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
-      }
+      Face_triangulation& ft=face_triangulations[i-batch_begin];
+      if (!ft.initialized)
+        init_face_triangulation(f, it_fb, face_boundaries, tm,
+                                vertex_to_node_id, nb_nodes, ft);
+      if (it_fb!=face_boundaries.end() && (doing_autorefinement || handle_non_manifold_features))
+        it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
+
+      std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+      std::array<Node_id,3>& f_indices = ft.f_indices;
+      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
 
-      // handle possible presence of degenerate faces
-      if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
+      if (!ft.cdt)
       {
-        Node_ids face_vertex_nids;
+        // handle possible presence of degenerate faces
+        if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
+        {
+          Node_ids face_vertex_nids;
 
-        //check if one of the triangle input vertex is also a node
-        for (int ik=0;ik<3;++ik)
-          if ( f_indices[ik]<nb_nodes )
-            face_vertex_nids.push_back(f_indices[ik]);
+          //check if one of the triangle input vertex is also a node
+          for (int ik=0;ik<3;++ik)
+            if ( f_indices[ik]<nb_nodes )
+              face_vertex_nids.push_back(f_indices[ik]);
 
-        // collect nodes on edges (if any)
-        if (it_fb != face_boundaries.end())
-        {
-          Face_boundary& f_boundary=it_fb->second;
-          for (int i=0;i<3;++i)
-            std::copy(f_boundary.node_ids_array[i].begin(),
-                      f_boundary.node_ids_array[i].end(),
-                      std::back_inserter(face_vertex_nids));
-        }
+          // collect nodes on edges (if any)
+          if (it_fb != face_boundaries.end())
+          {
+            Face_boundary& f_boundary=it_fb->second;
+            for (int i=0;i<3;++i)
+              std::copy(f_boundary.node_ids_array[i].begin(),
+                        f_boundary.node_ids_array[i].end(),
+                        std::back_inserter(face_vertex_nids));
+          }
 
-        std::sort(face_vertex_nids.begin(), face_vertex_nids.end());
-        std::vector<std::array<std::pair<halfedge_descriptor,Node_id>,2>> constraints;
-        for(Node_id id : face_vertex_nids)
-        {
-          CGAL_assertion(id < graph_of_constraints.size());
-          const std::vector<Node_id>& neighbors=graph_of_constraints[id];
-          if (!neighbors.empty())
+          std::sort(face_vertex_nids.begin(), face_vertex_nids.end());
+          std::vector<std::array<std::pair<halfedge_descriptor,Node_id>,2>> constraints;
+          for(Node_id id : face_vertex_nids)
           {
-            for(Node_id id_n :neighbors)
+            CGAL_assertion(id < graph_of_constraints.size());
+            const std::vector<Node_id>& neighbors=graph_of_constraints[id];
+            if (!neighbors.empty())
             {
-              if (id_n<id) continue;
-              if (std::binary_search(face_vertex_nids.begin(), face_vertex_nids.end(), id_n))
+              for(Node_id id_n :neighbors)
               {
-                vertex_descriptor vi = node_id_to_vertex.get_vertex(id),
-                                  vn = node_id_to_vertex.get_vertex(id_n);
-                bool is_face_border = false;
-                halfedge_descriptor h;
-
-                std::tie(h, is_face_border) = halfedge(vi,vn, tm);
-                if (is_face_border)
+                if (id_n<id) continue;
+                if (std::binary_search(face_vertex_nids.begin(), face_vertex_nids.end(), id_n))
                 {
-                  call_put(marks_on_edges,tm,edge(h,tm),true);
-                  output_builder.set_edge_per_polyline(tm,std::make_pair(id, id_n),h);
-                }
-                else
-                {
-                  halfedge_descriptor hi=halfedge(vi, tm);
-                  while(face(hi, tm) != f)
-                    hi=opposite(next(hi, tm), tm);
-
-                  halfedge_descriptor hn=halfedge(vn, tm);
-                  while(face(hn, tm) != f)
-                    hn=opposite(next(hn, tm), tm);
-                  constraints.emplace_back(make_array(std::make_pair(hi,id),std::make_pair(hn, id_n)));
+                  vertex_descriptor vi = node_id_to_vertex.get_vertex(id),
+                                    vn = node_id_to_vertex.get_vertex(id_n);
+                  bool is_face_border = false;
+                  halfedge_descriptor h;
+
+                  std::tie(h, is_face_border) = halfedge(vi,vn, tm);
+                  if (is_face_border)
+                  {
+                    call_put(marks_on_edges,tm,edge(h,tm),true);
+                    output_builder.set_edge_per_polyline(tm,std::make_pair(id, id_n),h);
+                  }
+                  else
+                  {
+                    halfedge_descriptor hi=halfedge(vi, tm);
+                    while(face(hi, tm) != f)
+                      hi=opposite(next(hi, tm), tm);
+
+                    halfedge_descriptor hn=halfedge(vn, tm);
+                    while(face(hn, tm) != f)
+                      hn=opposite(next(hn, tm), tm);
+                    constraints.emplace_back(make_array(std::make_pair(hi,id),std::make_pair(hn, id_n)));
+                  }
                 }
               }
             }
+            #ifdef CGAL_COREFINEMENT_DEBUG
+            else
+              std::cout << "X0bis: Found an isolated point" << std::endl;
+            #endif
           }
-          #ifdef CGAL_COREFINEMENT_DEBUG
-          else
-            std::cout << "X0bis: Found an isolated point" << std::endl;
-          #endif
-        }
 
-        CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
-        std::vector<face_descriptor> new_faces;
-        for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
-        {
-          halfedge_descriptor nh = Euler::split_face(a[0].first, a[1].first, tm);
-          new_faces.push_back(face(opposite(nh, tm), tm));
+          CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
+          std::vector<face_descriptor> new_faces;
+          for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
+          {
+            halfedge_descriptor nh = Euler::split_face(a[0].first, a[1].first, tm);
+            new_faces.push_back(face(opposite(nh, tm), tm));
 
-          call_put(marks_on_edges,tm,edge(nh,tm),true);
-          output_builder.set_edge_per_polyline(tm,std::make_pair(a[0].second, a[1].second),nh);
-        }
+            call_put(marks_on_edges,tm,edge(nh,tm),true);
+            output_builder.set_edge_per_polyline(tm,std::make_pair(a[0].second, a[1].second),nh);
+          }
 
-        // now triangulate new faces
-        if (!new_faces.empty())
-        {
-          new_faces.push_back(f);
-          for(face_descriptor nf : new_faces)
+          // now triangulate new faces
+          if (!new_faces.empty())
           {
-            halfedge_descriptor h = halfedge(nf, tm),
-                                nh = next(next(h,tm),tm);
-            while(next(nh, tm)!=h)
-              nh=next(Euler::split_face(h, nh, tm), tm);
+            new_faces.push_back(f);
+            for(face_descriptor nf : new_faces)
+            {
+              halfedge_descriptor h = halfedge(nf, tm),
+                                  nh = next(next(h,tm),tm);
+              while(next(nh, tm)!=h)
+                nh=next(Euler::split_face(h, nh, tm), tm);
+            }
           }
-        }
 
-        continue;
+          continue;
+        }
+        build_face_triangulation(it_fb, face_boundaries, node_ids, tm, vpm,
+                                 nodes, nb_nodes, ft);
       }
-
-      typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
-                           q = nodes.to_exact(get(vpm,f_vertices[1])),
-                           r = nodes.to_exact(get(vpm,f_vertices[2]));
-///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
-      CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
-      CDT cdt(traits);
-
-      // insert triangle points
-      std::array<CDT_Vertex_handle,3> triangle_vertices;
-      //we can do this to_exact because these are supposed to be input points.
-      triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
-      triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
-      triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
-      triangle_vertices[2]->set_point(r);
-
-      triangle_vertices[0]->info()=f_indices[0];
-      triangle_vertices[1]->info()=f_indices[1];
-      triangle_vertices[2]->info()=f_indices[2];
+      CDT& cdt = *ft.cdt;
+      std::vector<std::pair<Node_id,Node_id> >& constrained_edges = ft.constrained_edges;
 
       node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
       node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
       node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
 
       //if one of the triangle input vertex is also a node
-      for (int ik=0;ik<3;++ik){
-        if ( f_indices[ik]<nb_nodes )
-        {
-          id_to_CDT_vh.insert(
-              std::make_pair(f_indices[ik],triangle_vertices[ik]));
-          if (doing_autorefinement || handle_non_manifold_features)
+      if (doing_autorefinement || handle_non_manifold_features)
+        for (int ik=0;ik<3;++ik)
+          if ( f_indices[ik]<nb_nodes )
             // update the current vertex in node_id_to_vertex
             // to match the one of the face
             node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
             // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
             // it is OK not to store all vertices corresponding to this id as the approximate version
             // is already tight and the call in Intersection_nodes::finalize() will not fix anything
-        }
-      }
-      //insert points on edges
-      if (it_fb!=face_boundaries.end()) //if f not a triangle?
-      {
-        // collect infinite faces incident to the initial triangle
-        typename CDT::Face_handle infinite_faces[3];
-        for (int i=0;i<3;++i)
-        {
-          int oi=-1;
-          CGAL_assertion_code(bool is_edge = )
-          cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
-          CGAL_assertion(is_edge);
-          CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
-        }
-
-        // In this loop, for each original edge of the triangle, we insert
-        // the constrained edges and we recover the halfedge_descriptor
-        // corresponding to these constrained (they are already in tm)
-        Face_boundary& f_boundary=it_fb->second;
-        for (int i=0;i<3;++i){
-          //handle case of halfedge starting at triangle_vertices[i]
-          // and ending at triangle_vertices[(i+1)%3]
-
-          const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
-          CDT_Vertex_handle previous=triangle_vertices[i];
-          Node_id prev_index=f_indices[i];// node-id of the mesh vertex
-          halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
-          CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
-          if (!ids_on_edge.empty()){ //is there at least one node on this edge?
-            // fh must be an infinite face
-            // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
-            for(Node_id id : ids_on_edge)
-            {
-              CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
-              vh->info()=id;
-              id_to_CDT_vh.insert(std::make_pair(id,vh));
-              edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
-              previous=vh;
-              hedge=next(hedge,tm);
-              prev_index=id;
-            }
-          }
-          else{
-          CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
-            CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
-            CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
-          }
-          CGAL_assertion(hedge==f_boundary.halfedges[i]);
-          edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
-            it_fb->second.halfedges[i];
-        }
-      }
-
-      //insert point inside face
-      for(Node_id node_id : node_ids)
-      {
-        CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
-        vh->info()=node_id;
-        id_to_CDT_vh.insert(std::make_pair(node_id,vh));
-      }
-
-      std::vector<std::pair<Node_id,Node_id> > constrained_edges;
-
-      // insert constraints that are interior to the triangle (in the case
-      // no edges are collinear in the meshes)
-      insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
-
-      // insert constraints between points that are on the boundary
-      // (not a constrained on the triangle boundary)
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (int i=0;i<3;++i)
-        {
-          Node_ids& ids=it_fb->second.node_ids_array[i];
-          insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
-        }
-      }
-
-      //insert coplanar edges for endpoints of triangles
-      for (int i=0;i<3;++i){
-        Node_id nindex=triangle_vertices[i]->info();
-        if ( nindex < nb_nodes )
-          insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
-      }
 
       //XSL_TAG_CPL_VERT
       //collect edges incident to a point that is the intersection of two
@@ -1531,9 +1669,11 @@ public:
           output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
         }
       }
+      // release the triangulation
+      ft = Face_triangulation();
+    }
     }
   }
-
   void check_no_duplicates(const INodes& nodes) const
   {
     if (const_mesh_ptr == nullptr) // actually only needed for clip
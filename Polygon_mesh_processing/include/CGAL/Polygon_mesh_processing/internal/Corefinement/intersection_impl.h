@@ -26,12 +26,20 @@
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
 #include <CGAL/Polygon_mesh_processing/bbox.h>
 #include <CGAL/utility.h>
+#include <CGAL/tags.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -194,7 +202,8 @@ struct Node_id_set {
 
 template< class TriangleMesh,
           class VertexPointMap1, class VertexPointMap2,
-          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>
+          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>,
+          class ConcurrencyTag=Sequential_tag
          >
 class Intersection_of_triangle_meshes
 {
@@ -943,11 +952,42 @@ class Intersection_of_triangle_meshes
                                    Node_id& current_node)
   {
     typedef std::tuple<Intersection_type, halfedge_descriptor, bool,bool>  Inter_type;
+    typedef std::vector<std::pair<face_descriptor, Inter_type> >          Inter_types;
 
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    // With Parallel_tag, the intersection types of all the candidate pairs
+    // (edge, face) are computed concurrently beforehand. They only depend on
+    // the input meshes, so that the nodes are then created in the same order
+    // as in the sequential version.
+    std::vector<Inter_types> precomputed_inter_types;
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      std::vector<typename Edge_to_faces::iterator> entries;
+      entries.reserve(tm1_edge_to_tm2_faces.size());
+      for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
+                                           it!=tm1_edge_to_tm2_faces.end();++it)
+        entries.push_back(it);
+
+      precomputed_inter_types.resize(entries.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, entries.size()),
+        [&](const tbb::blocked_range<std::size_t>& range)
+        {
+          for (std::size_t i=range.begin(); i!=range.end(); ++i)
+          {
+            halfedge_descriptor h_1=halfedge(entries[i]->first,tm1);
+            for (face_descriptor f_2 : entries[i]->second)
+              precomputed_inter_types[i].emplace_back(
+                f_2, intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2));
+          }
+        });
+    }
+#endif
+
+    std::size_t entry_index=0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++entry_index)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
@@ -957,7 +997,18 @@ class Intersection_of_triangle_meshes
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        typename Inter_types::const_iterator precomputed_end, precomputed_res;
+        if (!precomputed_inter_types.empty())
+        {
+          const Inter_types& inter_types=precomputed_inter_types[entry_index];
+          precomputed_end=inter_types.end();
+          precomputed_res=std::find_if(inter_types.begin(), precomputed_end,
+                                       [f_2](const std::pair<face_descriptor, Inter_type>& p)
+                                       { return p.first==f_2; });
+        }
+        Inter_type res=(!precomputed_inter_types.empty() && precomputed_res!=precomputed_end)
+                      ? precomputed_res->second
+                      : intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
@@ -23,6 +23,8 @@
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/use.h>
+#include <map>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -94,48 +96,86 @@ struct Tracer_polyhedron
   std::vector<halfedge_descriptor>& P;
 };
 
-// This function is used in test cases (since it returns not just OutputIterator but also Weight)
-template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
-std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
-triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
-            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
-            OutputIterator out,
-            VertexPointMap vpmap,
-            bool use_delaunay_triangulation,
-            const Kernel& k,
-            const bool use_cdt,
-            const bool skip_cubic_algorithm,
-            Visitor& visitor,
-            const typename Kernel::FT max_squared_distance)
+// Records the entries of the lookup table that are used to trace the patch,
+// so that the patch can be added to the mesh later on with `Tracer_polyhedron`.
+// This allows to triangulate several holes concurrently.
+struct Tracer_lookup_table_recorder
 {
-#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
-  CGAL_USE(use_cdt);
-  CGAL_USE(max_squared_distance);
-#endif
+  Tracer_lookup_table_recorder()
+    : is_traced(false), last(0)
+  { }
 
+  template <class LookupTable>
+  void operator()(const LookupTable& lambda, int i, int k)
+  {
+    is_traced = true;
+    last = k;
+    record(lambda, i, k);
+  }
+
+  int get(int i, int k) const
+  {
+    CGAL_assertion(table.count(std::make_pair(i, k)) == 1);
+    return table.find(std::make_pair(i, k))->second;
+  }
+
+  bool is_traced;
+  int last;
+
+private:
+  template <class LookupTable>
+  void record(const LookupTable& lambda, int i, int k)
+  {
+    if(i + 2 >= k)
+      return;
+
+    int la = lambda.get(i, k);
+    table[std::make_pair(i, k)] = la;
+    record(lambda, i, la);
+    record(lambda, la, k);
+  }
+
+  std::map<std::pair<int, int>, int> table;
+};
+
+// The boundary of a hole, as used by the triangulation of the hole
+template<class PolygonMesh, class Point_3>
+struct Hole_boundary
+{
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+  std::vector<Point_3> P, Q;
+  std::vector<halfedge_descriptor> P_edges;
+  // existing_edges contains neighborhood information between boundary vertices
+  // more precisely if v_i is neighbor to any other vertex than v_(i-1) and v_(i+1),
+  // this edge is put into existing_edges
+  std::vector<std::pair<int, int> > existing_edges;
+};
+
+// Reads the boundary of the hole incident to `border_halfedge` without modifying `pmesh`.
+// Returns `false` if a non-manifold vertex is found on the boundary.
+template<class PolygonMesh, class VertexPointMap, class Point_3>
+bool
+read_hole_boundary(const PolygonMesh& pmesh,
+                   typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                   VertexPointMap vpmap,
+                   Hole_boundary<PolygonMesh, Point_3>& hole)
+{
   typedef Halfedge_around_face_circulator<PolygonMesh>   Hedge_around_face_circulator;
   typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
-  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
-  typedef typename Kernel::Point_3 Point_3;
 
   typedef std::map<vertex_descriptor, int>    Vertex_map;
   typedef typename Vertex_map::iterator       Vertex_map_it;
 
-#ifdef CGAL_PMP_HOLE_FILLING_DEBUG
-  CGAL::Timer timer; timer.start();
-#endif
-
-  std::vector<Point_3> P, Q;
-  std::vector<halfedge_descriptor> P_edges;
   Vertex_map vertex_map;
 
   int id = 0;
   Hedge_around_face_circulator circ(border_halfedge,pmesh), done(circ);
   do
   {
-    P.push_back(get(vpmap, target(*circ, pmesh)));
-    Q.push_back(get(vpmap, target(next(opposite(next(*circ,pmesh),pmesh),pmesh),pmesh)));
-    P_edges.push_back(*circ);
+    hole.P.push_back(get(vpmap, target(*circ, pmesh)));
+    hole.Q.push_back(get(vpmap, target(next(opposite(next(*circ,pmesh),pmesh),pmesh),pmesh)));
+    hole.P_edges.push_back(*circ);
     if(!vertex_map.insert(std::make_pair(target(*circ,pmesh), id++)).second)
     {
 #ifndef CGAL_TEST_SUITE
@@ -143,14 +183,10 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #else
       std::cerr << "W: Returning no output. Non-manifold vertex is found on boundary!\n";
 #endif
-      return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+      return false;
     }
   } while (++circ != done);
 
-  // existing_edges contains neighborhood information between boundary vertices
-  // more precisely if v_i is neighbor to any other vertex than v_(i-1) and v_(i+1),
-  // this edge is put into existing_edges
-  std::vector<std::pair<int, int> > existing_edges;
   for(Vertex_map_it v_it = vertex_map.begin(); v_it != vertex_map.end(); ++v_it)
   {
     int v_it_id = v_it->second;
@@ -172,12 +208,33 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
           //there is an edge incident to v_it, which is not next or previous
           //from vertex_map (checked by comparing IDs)
           if(v_it_id < v_it_neigh_id) // to include each edge only once
-            existing_edges.push_back(std::make_pair(v_it_id, v_it_neigh_id));
+            hole.existing_edges.push_back(std::make_pair(v_it_id, v_it_neigh_id));
         }
       }
     } while(++circ_vertex != done_vertex);
   }
 
+  return true;
+}
+
+// Triangulates the hole described by `hole`, calling `tracer` on success.
+// `pmesh` is only accessed through `tracer`.
+template<class PolygonMesh, class Point_3, class Tracer, class Kernel, class Visitor>
+CGAL::internal::Weight_min_max_dihedral_and_area
+triangulate_hole_boundary(Hole_boundary<PolygonMesh, Point_3>& hole,
+                          Tracer& tracer,
+                          bool use_delaunay_triangulation,
+                          const Kernel& k,
+                          const bool use_cdt,
+                          const bool skip_cubic_algorithm,
+                          Visitor& visitor,
+                          const typename Kernel::FT max_squared_distance)
+{
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+  CGAL_USE(use_cdt);
+  CGAL_USE(max_squared_distance);
+#endif
+
 //#define CGAL_USE_WEIGHT_INCOMPLETE
 #ifdef CGAL_USE_WEIGHT_INCOMPLETE
   typedef CGAL::internal::Weight_calculator<CGAL::internal::Weight_incomplete<CGAL::internal::Weight_min_max_dihedral_and_area>,
@@ -187,22 +244,51 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
         CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle> WC;
 #endif
 
-  CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
-
-  // fill hole using polyline function, with custom tracer for PolygonMesh
-  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+  CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(hole.existing_edges);
 
 #ifndef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
-  if(use_cdt && triangulate_hole_polyline_with_cdt(P, tracer, visitor, is_valid, k, max_squared_distance))
-    return std::make_pair(tracer.out, CGAL::internal::Weight_min_max_dihedral_and_area(0,0));
+  if(use_cdt && triangulate_hole_polyline_with_cdt(hole.P, tracer, visitor, is_valid, k, max_squared_distance))
+    return CGAL::internal::Weight_min_max_dihedral_and_area(0,0);
 #endif
-  CGAL::internal::Weight_min_max_dihedral_and_area weight =
+  return
 #ifndef CGAL_USE_WEIGHT_INCOMPLETE
-  triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k);
+  triangulate_hole_polyline(hole.P, hole.Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k);
 #else
   // get actual weight in Weight_incomplete
-  triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
+  triangulate_hole_polyline(hole.P, hole.Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
 #endif
+}
+
+// This function is used in test cases (since it returns not just OutputIterator but also Weight)
+template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
+std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
+triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
+            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+            OutputIterator out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            Visitor& visitor,
+            const typename Kernel::FT max_squared_distance)
+{
+  typedef typename Kernel::Point_3 Point_3;
+
+#ifdef CGAL_PMP_HOLE_FILLING_DEBUG
+  CGAL::Timer timer; timer.start();
+#endif
+
+  Hole_boundary<PolygonMesh, Point_3> hole;
+  if(!read_hole_boundary(pmesh, border_halfedge, vpmap, hole))
+    return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+
+  // fill hole using polyline function, with custom tracer for PolygonMesh
+  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, hole.P_edges);
+
+  CGAL::internal::Weight_min_max_dihedral_and_area weight =
+    triangulate_hole_boundary(hole, tracer, use_delaunay_triangulation, k,
+                              use_cdt, skip_cubic_algorithm, visitor, max_squared_distance);
 
 #ifdef CGAL_PMP_HOLE_FILLING_DEBUG
   std::cerr << "Hole filling: " << timer.time() << " sc." << std::endl; timer.reset();
@@ -36,6 +36,10 @@
 #include <boost/graph/graph_traits.hpp>
 #include <CGAL/tags.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <boost/bimap.hpp>
 #include <boost/bimap/multiset_of.hpp>
 #include <boost/bimap/set_of.hpp>
@@ -54,6 +58,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <type_traits>
 
 #ifdef CGAL_PMP_REMESHING_DEBUG
 #include <CGAL/Polygon_mesh_processing/self_intersections.h>
@@ -1014,7 +1019,7 @@ namespace internal {
     // "applies an iterative smoothing filter to the mesh.
     // The vertex movement has to be constrained to the vertex tangent plane [...]
     // smoothing algorithm with uniform Laplacian weights"
-    template <class SizingFunction, typename AllowMoveFunctor>
+    template <class ConcurrencyTag = Sequential_tag, class SizingFunction, typename AllowMoveFunctor>
     void tangential_relaxation_impl(const bool relax_constraints/*1d smoothing*/
                                   , const unsigned int nb_iterations
                                   , const SizingFunction& sizing
@@ -1065,6 +1070,7 @@ namespace internal {
             .vertex_is_constrained_map(constrained_vertices_pmap)
             .relax_constraints(relax_constraints)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
       else
@@ -1084,6 +1090,7 @@ namespace internal {
             .relax_constraints(relax_constraints)
             .sizing_function(sizing)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
 
@@ -1102,6 +1109,7 @@ namespace internal {
 
     // PMP book :
     // "maps the vertices back to the surface"
+    template <class ConcurrencyTag = Sequential_tag>
     void project_to_surface(internal_np::Param_not_found)
     {
       //todo : handle the case of boundary vertices
@@ -1110,6 +1118,28 @@ namespace internal {
       std::cout.flush();
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+      if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      {
+        // the vertices to project and their trees are collected first,
+        // the closest point queries are then done concurrently
+        std::vector<std::pair<vertex_descriptor, const AABB_tree*> > to_project;
+        for(vertex_descriptor v : vertices(mesh_))
+        {
+          if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
+            continue;
+          to_project.emplace_back(v, trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]);
+        }
+
+        tbb::parallel_for(std::size_t(0), to_project.size(), [&](std::size_t i)
+        {
+          const vertex_descriptor v = to_project[i].first;
+          Point proj = to_project[i].second->closest_point(get(vpmap_, v));
+          put(vpmap_, v, proj);
+        });
+      }
+      else
+#endif
       for(vertex_descriptor v : vertices(mesh_))
       {
         if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
@@ -1132,13 +1162,28 @@ namespace internal {
 #endif
     }
 
-    template <class ProjectionFunctor>
+    template <class ConcurrencyTag = Sequential_tag, class ProjectionFunctor>
     void project_to_surface(const ProjectionFunctor& proj)
     {
       //todo : handle the case of boundary vertices
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       std::cout << "Project to surface...";
       std::cout.flush();
+#endif
+#ifdef CGAL_LINKED_WITH_TBB
+      if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      {
+        std::vector<vertex_descriptor> to_project;
+        for(vertex_descriptor v : vertices(mesh_))
+          if (!is_constrained(v) && !is_isolated(v) && is_on_patch(v))
+            to_project.push_back(v);
+
+        tbb::parallel_for(std::size_t(0), to_project.size(), [&](std::size_t i)
+        {
+          put(vpmap_, to_project[i], proj(to_project[i]));
+        });
+      }
+      else
 #endif
       for(vertex_descriptor v : vertices(mesh_))
       {
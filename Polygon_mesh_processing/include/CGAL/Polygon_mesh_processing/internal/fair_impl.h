@@ -18,6 +18,8 @@
 
 #include <map>
 #include <set>
+#include <utility>
+#include <vector>
 #include <CGAL/assertions.h>
 #include <CGAL/boost/graph/helpers.h>
 #ifdef CGAL_PMP_FAIR_DEBUG
@@ -115,6 +117,22 @@ public:
   bool fair(const VertexRange& vertices
     , SparseLinearSolver solver
     , unsigned int fc)
+  {
+    std::vector<std::pair<vertex_descriptor, Point_3> > positions;
+    if(!compute_fair_positions(vertices, solver, fc, positions))
+      return false;
+
+    for(const std::pair<vertex_descriptor, Point_3>& vp : positions)
+      put(ppmap, vp.first, vp.second);
+    return true;
+  }
+
+  // same as `fair()` but the vertices are not moved, their new positions are put in `positions`
+  template<class VertexRange>
+  bool compute_fair_positions(const VertexRange& vertices
+    , SparseLinearSolver solver
+    , unsigned int fc
+    , std::vector<std::pair<vertex_descriptor, Point_3> >& positions)
   {
     int depth = static_cast<int>(fc) + 1;
     if(depth < 0 || depth > 3) {
@@ -190,9 +208,10 @@ public:
 
     // update
     id = 0;
+    positions.reserve(positions.size() + nb_vertices);
     for(vertex_descriptor vd : interior_vertices)
     {
-      put(ppmap, vd, Point_3(X[id], Y[id], Z[id]));
+      positions.push_back(std::make_pair(vd, Point_3(X[id], Y[id], Z[id])));
       ++id;
     }
     return true;
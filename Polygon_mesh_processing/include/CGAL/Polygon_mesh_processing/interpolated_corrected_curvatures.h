@@ -22,11 +22,22 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/property_map.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 #include <Eigen/Eigenvalues>
 
+#include <boost/container/small_vector.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <array>
 #include <numeric>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 namespace CGAL {
 
@@ -86,9 +97,17 @@ struct Vertex_measures {
                                                              0, 0, 0 };
 };
 
+// the vectors of the vertices of a face are stored in a buffer on the stack for triangles and quads
 template<typename GT>
-typename GT::FT interpolated_corrected_area_measure_face(const std::vector<typename GT::Vector_3>& u,
-  const std::vector<typename GT::Vector_3>& x)
+using Face_vectors = boost::container::small_vector<typename GT::Vector_3, 4>;
+
+// sub-triangles of the barycentric split of a polygon
+template<typename GT>
+using Triangle_vectors = std::array<typename GT::Vector_3, 3>;
+
+template<typename GT, typename VectorRange>
+typename GT::FT interpolated_corrected_area_measure_face(const VectorRange& u,
+  const VectorRange& x)
 {
   const std::size_t n = x.size();
   CGAL_precondition(u.size() == n);
@@ -133,17 +152,17 @@ typename GT::FT interpolated_corrected_area_measure_face(const std::vector<typen
     for (std::size_t i = 0; i < n; i++)
     {
       mu0 += interpolated_corrected_area_measure_face<GT>(
-        std::vector<typename GT::Vector_3> {u[i], u[(i + 1) % n], uc},
-        std::vector<typename GT::Vector_3> {x[i], x[(i + 1) % n], xc}
+        Triangle_vectors<GT>{ { u[i], u[(i + 1) % n], uc } },
+        Triangle_vectors<GT>{ { x[i], x[(i + 1) % n], xc } }
       );
     }
     return mu0;
   }
 }
 
-template<typename GT>
-typename GT::FT interpolated_corrected_mean_curvature_measure_face(const std::vector<typename GT::Vector_3>& u,
-  const std::vector<typename GT::Vector_3>& x)
+template<typename GT, typename VectorRange>
+typename GT::FT interpolated_corrected_mean_curvature_measure_face(const VectorRange& u,
+  const VectorRange& x)
 {
   const std::size_t n = x.size();
   CGAL_precondition(u.size() == n);
@@ -199,16 +218,16 @@ typename GT::FT interpolated_corrected_mean_curvature_measure_face(const std::ve
     for (std::size_t i = 0; i < n; i++)
     {
       mu1 += interpolated_corrected_mean_curvature_measure_face<GT>(
-        std::vector<typename GT::Vector_3> {u[i], u[(i + 1) % n], uc},
-        std::vector<typename GT::Vector_3> {x[i], x[(i + 1) % n], xc}
+        Triangle_vectors<GT>{ { u[i], u[(i + 1) % n], uc } },
+        Triangle_vectors<GT>{ { x[i], x[(i + 1) % n], xc } }
       );
     }
     return mu1;
   }
 }
 
-template<typename GT>
-typename GT::FT interpolated_corrected_Gaussian_curvature_measure_face(const std::vector<typename GT::Vector_3>& u)
+template<typename GT, typename VectorRange>
+typename GT::FT interpolated_corrected_Gaussian_curvature_measure_face(const VectorRange& u)
 {
   const std::size_t n = u.size();
   CGAL_precondition(n >= 3);
@@ -246,16 +265,16 @@ typename GT::FT interpolated_corrected_Gaussian_curvature_measure_face(const std
     for (std::size_t i = 0; i < n; i++)
     {
       mu2 += interpolated_corrected_Gaussian_curvature_measure_face<GT>(
-        std::vector<typename GT::Vector_3> {u[i], u[(i + 1) % n], uc}
+        Triangle_vectors<GT>{ { u[i], u[(i + 1) % n], uc } }
       );
     }
     return mu2;
   }
 }
 
-template<typename GT>
-std::array<typename GT::FT, 3 * 3> interpolated_corrected_anisotropic_measure_face(const std::vector<typename GT::Vector_3>& u,
-  const std::vector<typename GT::Vector_3>& x)
+template<typename GT, typename VectorRange>
+std::array<typename GT::FT, 3 * 3> interpolated_corrected_anisotropic_measure_face(const VectorRange& u,
+  const VectorRange& x)
 {
   const std::size_t n = x.size();
   CGAL_precondition(u.size() == n);
@@ -352,8 +371,8 @@ std::array<typename GT::FT, 3 * 3> interpolated_corrected_anisotropic_measure_fa
     {
       std::array<typename GT::FT, 3 * 3> muXY_curr_triangle =
         interpolated_corrected_anisotropic_measure_face<GT>(
-          std::vector<typename GT::Vector_3> {u[i], u[(i + 1) % n], uc},
-          std::vector<typename GT::Vector_3> {x[i], x[(i + 1) % n], xc}
+          Triangle_vectors<GT>{ { u[i], u[(i + 1) % n], uc } },
+          Triangle_vectors<GT>{ { x[i], x[(i + 1) % n], xc } }
       );
 
       for (std::size_t ix = 0; ix < 3; ix++)
@@ -364,8 +383,8 @@ std::array<typename GT::FT, 3 * 3> interpolated_corrected_anisotropic_measure_fa
   return muXY;
 }
 
-template<typename GT>
-typename GT::FT face_in_ball_ratio(const std::vector<typename GT::Vector_3>& x,
+template<typename GT, typename VectorRange>
+typename GT::FT face_in_ball_ratio(const VectorRange& x,
   const typename GT::FT r,
   const typename GT::Vector_3 c)
 {
@@ -464,8 +483,8 @@ Vertex_measures<GT> interpolated_corrected_measures_one_vertex_no_radius(
 
   Vertex_measures<GT> vertex_measures;
 
-  std::vector<Vector_3> x;
-  std::vector<Vector_3> u;
+  Face_vectors<GT> x;
+  Face_vectors<GT> u;
 
   // compute for each face around the vertex (except the null (boundary) face)
   for (face_descriptor f : faces_around_target(halfedge(v, pmesh), pmesh)) {
@@ -538,8 +557,8 @@ Vertex_measures<GT> interpolated_corrected_measures_one_vertex(
       bfs_visited.insert(f);
     }
   }
-  std::vector<Vector_3> x;
-  std::vector<Vector_3> u;
+  Face_vectors<GT> x;
+  Face_vectors<GT> u;
   while (!bfs_queue.empty()) {
     face_descriptor fi = bfs_queue.front();
     bfs_queue.pop();
@@ -716,6 +735,7 @@ class Interpolated_corrected_curvatures_computer
   typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
 
   typedef typename GetVertexPointMap<PolygonMesh, NamedParameters>::const_type Vertex_position_map;
+  typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type Face_index_map;
 
   typedef dynamic_vertex_property_t<Vector_3> Vector_map_tag;
   typedef typename boost::property_map<PolygonMesh, Vector_map_tag>::const_type Default_vector_map;
@@ -737,15 +757,26 @@ class Interpolated_corrected_curvatures_computer
     NamedParameters,
     Default_principal_map>::type Vertex_principal_curvatures_and_directions_map;
 
-  typedef typename boost::property_map<PolygonMesh,
-    CGAL::dynamic_face_property_t<FT>>::const_type Face_scalar_measure_map;
-  typedef typename boost::property_map<PolygonMesh,
-    CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>>::const_type Face_anisotropic_measure_map;
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag>::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  // containers of the BFS used for the ball expansion, reused from one vertex to the next
+  struct Ball_expansion_buffers {
+    std::vector<face_descriptor> queue;
+    std::unordered_set<face_descriptor> visited;
+  };
 
 private:
   const PolygonMesh& pmesh;
   Vertex_position_map vpm;
   Vertex_normal_map vnm;
+  Face_index_map fimap;
   FT ball_radius;
   FT avg_edge_length;
 
@@ -757,14 +788,19 @@ private:
   Vertex_Gaussian_curvature_map gaussian_curvature_map;
   Vertex_principal_curvatures_and_directions_map principal_curvatures_and_directions_map;
 
-  Face_scalar_measure_map mu0_map, mu1_map, mu2_map;
-  Face_anisotropic_measure_map muXY_map;
-
-  void set_property_maps() {
-    mu0_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    mu1_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    mu2_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    muXY_map = get(CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>(), pmesh);
+  // measures of the faces, indexed by `fimap`
+  std::vector<FT> mu0, mu1, mu2;
+  std::vector<std::array<FT, 3 * 3>> muXY;
+
+  void set_face_measures() {
+    const std::size_t nf = num_faces(pmesh);
+    mu0.assign(nf, FT(0));
+    if (is_mean_curvature_selected)
+      mu1.assign(nf, FT(0));
+    if (is_Gaussian_curvature_selected)
+      mu2.assign(nf, FT(0));
+    if (is_principal_curvatures_and_directions_selected)
+      muXY.assign(nf, std::array<FT, 3 * 3>{ 0 });
   }
 
   void set_named_params(const NamedParameters& np)
@@ -809,13 +845,13 @@ private:
 public:
 
   Interpolated_corrected_curvatures_computer(const PolygonMesh& pmesh,const NamedParameters& np)
-    : pmesh(pmesh)
+    : pmesh(pmesh), fimap(get_initialized_face_index_map(pmesh, np))
   {
     set_named_params(np);
 
     if (is_mean_curvature_selected || is_Gaussian_curvature_selected || is_principal_curvatures_and_directions_selected)
     {
-      set_property_maps();
+      set_face_measures();
 
       compute_selected_curvatures();
     }
@@ -823,42 +859,78 @@ public:
 
 private:
 
+  // Computes the (selected) interpolated corrected measures of the face f
+  void interpolated_corrected_selected_measures_face(face_descriptor f)
+  {
+    Face_vectors<GT> x;
+    Face_vectors<GT> u;
+
+    for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+    {
+      const Point_3& p = get(vpm, v);
+      x.push_back(Vector_3(p.x(), p.y(), p.z()));
+      u.push_back(get(vnm, v));
+    }
+
+    const std::size_t fi = get(fimap, f);
+    mu0[fi] = interpolated_corrected_area_measure_face<GT>(u, x);
+
+    if (is_mean_curvature_selected)
+      mu1[fi] = interpolated_corrected_mean_curvature_measure_face<GT>(u, x);
+
+    if (is_Gaussian_curvature_selected)
+      mu2[fi] = interpolated_corrected_Gaussian_curvature_measure_face<GT>(u);
+
+    if (is_principal_curvatures_and_directions_selected)
+      muXY[fi] = interpolated_corrected_anisotropic_measure_face<GT>(u, x);
+  }
+
   // Computes the (selected) interpolated corrected measures for all faces
-  // and stores them in the property maps
   void interpolated_corrected_selected_measures_all_faces()
   {
-    std::vector<Vector_3> x;
-    std::vector<Vector_3> u;
-    // minimal number of vertices per face is 3
-    x.reserve(3);
-    u.reserve(3);
-
-    for (face_descriptor f : faces(pmesh))
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
     {
-      for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
-      {
-        const Point_3& p = get(vpm, v);
-        x.push_back(Vector_3(p.x(), p.y(), p.z()));
-        u.push_back(get(vnm, v));
-      }
-      put(mu0_map, f, interpolated_corrected_area_measure_face<GT>(u, x));
+      const std::vector<face_descriptor> face_vector(faces(pmesh).begin(), faces(pmesh).end());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, face_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            interpolated_corrected_selected_measures_face(face_vector[i]);
+                        });
+    }
+    else
+#endif
+    {
+      for (face_descriptor f : faces(pmesh))
+        interpolated_corrected_selected_measures_face(f);
+    }
+  }
 
-      if (is_mean_curvature_selected)
-        put(mu1_map, f, interpolated_corrected_mean_curvature_measure_face<GT>(u, x));
+  // adds the measures of the face f, weighted by f_ratio
+  void add_face_measures(face_descriptor f, const FT f_ratio, Vertex_measures<GT>& vertex_measures) const
+  {
+    const std::size_t fi = get(fimap, f);
 
-      if (is_Gaussian_curvature_selected)
-        put(mu2_map, f, interpolated_corrected_Gaussian_curvature_measure_face<GT>(u));
+    // only add the measures for the selected curvatures (area measure is always added)
+    vertex_measures.area_measure += f_ratio * mu0[fi];
 
-      if (is_principal_curvatures_and_directions_selected)
-        put(muXY_map, f, interpolated_corrected_anisotropic_measure_face<GT>(u, x));
+    if (is_mean_curvature_selected)
+      vertex_measures.mean_curvature_measure += f_ratio * mu1[fi];
 
-      x.clear();
-      u.clear();
+    if (is_Gaussian_curvature_selected)
+      vertex_measures.gaussian_curvature_measure += f_ratio * mu2[fi];
+
+    if (is_principal_curvatures_and_directions_selected)
+    {
+      const std::array<FT, 3 * 3>& face_anisotropic_measure = muXY[fi];
+      for (std::size_t i = 0; i < 3 * 3; i++)
+        vertex_measures.anisotropic_measure[i] += f_ratio * face_anisotropic_measure[i];
     }
   }
 
   // expand the measures of the faces incident to v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v) const
   {
     Vertex_measures<GT> vertex_measures;
 
@@ -867,32 +939,21 @@ private:
       if (f == boost::graph_traits<PolygonMesh>::null_face())
         continue;
 
-      // only add the measures for the selected curvatures (area measure is always added)
-      vertex_measures.area_measure += get(mu0_map, f);
-
-      if (is_mean_curvature_selected)
-        vertex_measures.mean_curvature_measure += get(mu1_map, f);
-
-      if (is_Gaussian_curvature_selected)
-        vertex_measures.gaussian_curvature_measure += get(mu2_map, f);
-
-      if (is_principal_curvatures_and_directions_selected)
-      {
-        const std::array<FT, 3 * 3> face_anisotropic_measure = get(muXY_map, f);
-        for (std::size_t i = 0; i < 3 * 3; i++)
-          vertex_measures.anisotropic_measure[i] += face_anisotropic_measure[i];
-      }
+      add_face_measures(f, FT(1), vertex_measures);
     }
 
     return vertex_measures;
   }
 
   // expand the measures of the faces inside the ball of radius r around v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v,
+                                                                   Ball_expansion_buffers& buffers) const
   {
     // the ball expansion is done using a BFS traversal from the vertex
-    std::queue<face_descriptor> bfs_queue;
-    std::unordered_set<face_descriptor> bfs_visited;
+    std::vector<face_descriptor>& bfs_queue = buffers.queue;
+    std::unordered_set<face_descriptor>& bfs_visited = buffers.visited;
+    bfs_queue.clear();
+    bfs_visited.clear();
 
     const Point_3& vp = get(vpm, v);
     const Vector_3& c = Vector_3(vp.x(), vp.y(), vp.z());
@@ -903,16 +964,17 @@ private:
     for (face_descriptor f : faces_around_target(halfedge(v, pmesh), pmesh)) {
       if (f != boost::graph_traits<PolygonMesh>::null_face())
       {
-        bfs_queue.push(f);
+        bfs_queue.push_back(f);
         bfs_visited.insert(f);
       }
     }
-    while (!bfs_queue.empty()) {
-      face_descriptor fi = bfs_queue.front();
-      bfs_queue.pop();
+
+    Face_vectors<GT> x;
+    for (std::size_t head = 0; head < bfs_queue.size(); ++head) {
+      const face_descriptor fi = bfs_queue[head];
 
       // looping over vertices in face to get point coordinates
-      std::vector<Vector_3> x;
+      x.clear();
       for (vertex_descriptor vi : vertices_around_face(halfedge(fi, pmesh), pmesh))
       {
         const Point_3& pi = get(vpm, vi);
@@ -923,29 +985,15 @@ private:
       const FT f_ratio = face_in_ball_ratio<GT>(x, ball_radius, c);
 
       // if the face is inside the ball, add the measures
-      // only add the measures for the selected curvatures (area measure is always added)
       if (!is_zero(f_ratio))
       {
-        vertex_measures.area_measure += f_ratio * get(mu0_map, fi);
-
-        if (is_mean_curvature_selected)
-          vertex_measures.mean_curvature_measure += f_ratio * get(mu1_map, fi);
-
-        if (is_Gaussian_curvature_selected)
-          vertex_measures.gaussian_curvature_measure += f_ratio * get(mu2_map, fi);
-
-        if (is_principal_curvatures_and_directions_selected)
-        {
-          const std::array<FT, 3 * 3> face_anisotropic_measure = get(muXY_map, fi);
-          for (std::size_t i = 0; i < 3 * 3; i++)
-            vertex_measures.anisotropic_measure[i] += f_ratio * face_anisotropic_measure[i];
-        }
+        add_face_measures(fi, f_ratio, vertex_measures);
 
         for (face_descriptor fj : faces_around_face(halfedge(fi, pmesh), pmesh))
         {
           if (bfs_visited.find(fj) == bfs_visited.end() && fj != boost::graph_traits<PolygonMesh>::null_face())
           {
-            bfs_queue.push(fj);
+            bfs_queue.push_back(fj);
             bfs_visited.insert(fj);
           }
         }
@@ -954,41 +1002,80 @@ private:
     return vertex_measures;
   }
 
+  // curvatures of a vertex, before they are written in the property maps
+  struct Vertex_curvatures {
+    FT mean_curvature = 0;
+    FT gaussian_curvature = 0;
+    Principal_curvatures_and_directions<GT> principal_curvatures_and_directions;
+  };
+
+  Vertex_curvatures compute_selected_curvatures(vertex_descriptor v, Ball_expansion_buffers& buffers) const
+  {
+    // expand the computed measures (on faces) to the vertices
+    Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
+      expand_interpolated_corrected_measure_vertex_no_radius(v) :
+      expand_interpolated_corrected_measure_vertex(v, buffers);
+
+    // compute the selected curvatures from the expanded measures
+    // if the area measure is zero, the curvature is set to zero
+    Vertex_curvatures curvatures;
+    if (is_mean_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.mean_curvature = 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure;
+
+    if (is_Gaussian_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.gaussian_curvature = vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure;
+
+    if (is_principal_curvatures_and_directions_selected) {
+      // compute the principal curvatures and directions from the anisotropic measure
+      const Vector_3& v_normal = get(vnm, v);
+      curvatures.principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
+        vertex_measures.anisotropic_measure,
+        vertex_measures.area_measure,
+        v_normal,
+        avg_edge_length
+        );
+    }
+    return curvatures;
+  }
+
+  // stores the curvatures of `v` in the property maps
+  void put_selected_curvatures(vertex_descriptor v, const Vertex_curvatures& curvatures)
+  {
+    if (is_mean_curvature_selected)
+      put(mean_curvature_map, v, curvatures.mean_curvature);
+    if (is_Gaussian_curvature_selected)
+      put(gaussian_curvature_map, v, curvatures.gaussian_curvature);
+    if (is_principal_curvatures_and_directions_selected)
+      put(principal_curvatures_and_directions_map, v, curvatures.principal_curvatures_and_directions);
+  }
+
   void compute_selected_curvatures() {
     interpolated_corrected_selected_measures_all_faces();
 
-    for (vertex_descriptor v : vertices(pmesh))
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
     {
-      // expand the computed measures (on faces) to the vertices
-      Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
-        expand_interpolated_corrected_measure_vertex_no_radius(v) :
-        expand_interpolated_corrected_measure_vertex(v);
-
-      // compute the selected curvatures from the expanded measures and store them in the property maps
-      // if the area measure is zero, the curvature is set to zero
-      if (is_mean_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(mean_curvature_map, v, 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure) :
-          put(mean_curvature_map, v, 0);
-      }
-
-      if (is_Gaussian_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(gaussian_curvature_map, v, vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure) :
-          put(gaussian_curvature_map, v, 0);
-      }
-
-      if (is_principal_curvatures_and_directions_selected) {
-        // compute the principal curvatures and directions from the anisotropic measure
-        const Vector_3& v_normal = get(vnm, v);
-        const Principal_curvatures_and_directions<GT> principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
-          vertex_measures.anisotropic_measure,
-          vertex_measures.area_measure,
-          v_normal,
-          avg_edge_length
-          );
-        put(principal_curvatures_and_directions_map, v, principal_curvatures_and_directions);
-      }
+      // each block of vertices has its own BFS containers
+      const std::vector<vertex_descriptor> vertex_vector(vertices(pmesh).begin(), vertices(pmesh).end());
+      std::vector<Vertex_curvatures> curvatures(vertex_vector.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          Ball_expansion_buffers buffers;
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            curvatures[i] = compute_selected_curvatures(vertex_vector[i], buffers);
+                        });
+
+      // the maps are not required to support concurrent writes
+      for (std::size_t i = 0; i < vertex_vector.size(); ++i)
+        put_selected_curvatures(vertex_vector[i], curvatures[i]);
+    }
+    else
+#endif
+    {
+      Ball_expansion_buffers buffers;
+      for (vertex_descriptor v : vertices(pmesh))
+        put_selected_curvatures(v, compute_selected_curvatures(v, buffers));
     }
   }
 };
@@ -1048,6 +1135,12 @@ private:
 *                     measures on faces around the vertex.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*   \cgalParamNEnd
+*
 *   \cgalParamNBegin{vertex_point_map}
 *     \cgalParamDescription{a property map associating points to the vertices of `pmesh`.}
 *     \cgalParamType{a class model of `ReadablePropertyMap` with
@@ -1068,6 +1161,13 @@ private:
 *                     computed using `compute_vertex_normals()`.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{face_index_map}
+*     \cgalParamDescription{a property map associating to each face of `pmesh` a unique index between `0` and `num_faces(pmesh) - 1`}
+*     \cgalParamType{a class model of `ReadablePropertyMap` with `boost::graph_traits<PolygonMesh>::%face_descriptor`
+*                    as key type and `std::size_t` as value type}
+*     \cgalParamDefault{an automatically indexed internal map}
+*   \cgalParamNEnd
+*
 *   \cgalParamNBegin{geom_traits}
 *     \cgalParamDescription{an instance of a geometric traits class.}
 *     \cgalParamType{a class model of `Kernel`}
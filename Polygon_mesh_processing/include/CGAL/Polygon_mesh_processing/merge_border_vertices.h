@@ -22,10 +22,16 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Polygon_mesh_processing/stitch_borders.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <type_traits>
 #include <vector>
 #include <utility>
 
@@ -204,6 +210,30 @@ void detect_identical_mergeable_vertices(
   }
 }
 
+// collects the halfedges of the boundary cycle of `h` and the groups of halfedges
+// of this cycle whose targets can be merged
+template <class PolygonMesh, class Vpm>
+void collect_mergeable_vertices_in_boundary_cycle(
+        typename boost::graph_traits<PolygonMesh>::halfedge_descriptor h,
+        std::vector< std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor> >& hedges_with_identical_point_target,
+        const PolygonMesh& pm,
+        Vpm vpm)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+  // collect all the halfedges of the cycle
+  std::vector< std::pair<halfedge_descriptor, std::size_t> > cycle_hedges;
+  halfedge_descriptor start=h;
+  std::size_t index=0;
+  do{
+    cycle_hedges.push_back( std::make_pair(h, index) );
+    h=next(h, pm);
+    ++index;
+  }while(start!=h);
+
+  detect_identical_mergeable_vertices(cycle_hedges, hedges_with_identical_point_target, pm, vpm);
+}
+
 // \ingroup PMP_combinatorial_repair_grp
 //
 // merges target vertices of a list of halfedges.
@@ -297,23 +327,12 @@ void merge_duplicated_vertices_in_boundary_cycle(typename boost::graph_traits<Po
   Vpm vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
                              get_const_property_map(vertex_point, pm));
 
-  // collect all the halfedges of the cycle
-  std::vector< std::pair<halfedge_descriptor, std::size_t> > cycle_hedges;
-  halfedge_descriptor start=h;
-  std::size_t index=0;
-  do{
-    cycle_hedges.push_back( std::make_pair(h, index) );
-    h=next(h, pm);
-    ++index;
-  }while(start!=h);
-
   std::vector< std::vector<halfedge_descriptor> > hedges_with_identical_point_target;
-  internal::detect_identical_mergeable_vertices(cycle_hedges, hedges_with_identical_point_target, pm, vpm);
+  internal::collect_mergeable_vertices_in_boundary_cycle(h, hedges_with_identical_point_target, pm, vpm);
 
   for(const std::vector<halfedge_descriptor>& hedges :
                 hedges_with_identical_point_target)
   {
-    start=hedges.front();
     // hedges are sorted along the cycle
     internal::merge_vertices_in_range(hedges, pm);
   }
@@ -336,6 +355,14 @@ void merge_duplicated_vertices_in_boundary_cycle(typename boost::graph_traits<Po
 ///                    as key type and `%Point_3` as value type}
 ///     \cgalParamDefault{`boost::get(CGAL::vertex_point, pm)`}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{In parallel, the duplicated vertices of the cycles are detected concurrently,
+///                     and then merged sequentially.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 /// \sa `merge_duplicated_vertices_in_boundary_cycle()`
@@ -346,9 +373,44 @@ void merge_duplicated_vertices_in_boundary_cycles(      PolygonMesh& pm,
 {
   typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type Concurrency_tag;
+
   std::vector<halfedge_descriptor> cycles;
   extract_boundary_cycles(pm, std::back_inserter(cycles));
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    typedef typename GetVertexPointMap<PolygonMesh, NamedParameters>::const_type Vpm;
+
+    using parameters::get_parameter;
+    using parameters::choose_parameter;
+
+    Vpm vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                               get_const_property_map(vertex_point, pm));
+
+    // Merging vertices in a cycle does not change the other cycles, so the detection
+    // can be done for all the cycles before any merge.
+    std::vector<std::vector<std::vector<halfedge_descriptor> > > hedges_per_cycle(cycles.size());
+    tbb::parallel_for(std::size_t(0), cycles.size(), [&](const std::size_t i)
+                      {
+                        internal::collect_mergeable_vertices_in_boundary_cycle(cycles[i], hedges_per_cycle[i],
+                                                                               pm, vpm);
+                      });
+
+    for(const std::vector<std::vector<halfedge_descriptor> >& hedges_with_identical_point_target : hedges_per_cycle)
+      for(const std::vector<halfedge_descriptor>& hedges : hedges_with_identical_point_target)
+        internal::merge_vertices_in_range(hedges, pm);
+
+    return;
+  }
+#endif
+
   for(halfedge_descriptor h : cycles)
     merge_duplicated_vertices_in_boundary_cycle(h, pm, np);
 }
@@ -23,13 +23,21 @@
 #include <CGAL/assertions.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/flat_set.hpp>
 #include <boost/container/flat_map.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
 #include <set>
 #include <map>
 #include <stack>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 #include <algorithm>
 #include <iostream>
@@ -174,7 +182,19 @@ struct Polygon_soup_orienter
   {}
 
 //filling containers
+  template <class ConcurrencyTag = Sequential_tag>
   static void fill_edge_map(Edge_map& edges, Marked_edges& marked_edges, const Polygons& polygons, Visitor& visitor) {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      fill_edge_map_in_parallel(edges, marked_edges, polygons, visitor);
+      return;
+    }
+#endif
+
     // Fill edges
     for (P_ID i = 0; i < polygons.size(); ++i)
     {
@@ -210,13 +230,82 @@ struct Polygon_soup_orienter
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // The directed edges of all polygons are sorted, so that the outgoing edges of a vertex
+  // are consecutive and can be inserted in order in its entry of the edge map.
+  // Non-manifold edges are detected concurrently, but reported in the same order
+  // as in the sequential version.
+  static void fill_edge_map_in_parallel(Edge_map& edges, Marked_edges& marked_edges,
+                                        const Polygons& polygons, Visitor& visitor)
+  {
+    typedef std::tuple<V_ID, V_ID, P_ID>                             Directed_edge;
+
+    const P_ID nb_polygons = polygons.size();
+    std::vector<std::size_t> offsets(nb_polygons + 1, 0);
+    for (P_ID i = 0; i < nb_polygons; ++i)
+      offsets[i+1] = offsets[i] + polygons[i].size();
+
+    std::vector<Directed_edge> directed_edges(offsets.back());
+    tbb::parallel_for(P_ID(0), nb_polygons, [&](const P_ID i)
+    {
+      const P_ID size = polygons[i].size();
+      for (P_ID j = 0; j < size; ++j)
+        directed_edges[offsets[i] + j] = Directed_edge(polygons[i][j], polygons[i][(j + 1) % size], i);
+    });
+    tbb::parallel_sort(directed_edges.begin(), directed_edges.end());
+
+    // Fill edges
+    tbb::parallel_for(std::size_t(0), edges.size(), [&](const std::size_t v)
+    {
+      typename std::vector<Directed_edge>::const_iterator it =
+        std::lower_bound(directed_edges.begin(), directed_edges.end(), Directed_edge(V_ID(v), V_ID(0), P_ID(0)));
+      for (; it != directed_edges.end() && std::get<0>(*it) == V_ID(v); ++it)
+        edges[v][std::get<1>(*it)].insert(std::get<2>(*it));
+    });
+
+    // Fill non-manifold edges
+    std::vector<std::size_t> nb_edges(offsets.back(), 0);
+    tbb::parallel_for(P_ID(0), nb_polygons, [&](const P_ID i)
+    {
+      const P_ID size = polygons[i].size();
+      for (P_ID j = 0; j < size; ++j) {
+        V_ID i0 = polygons[i][j];
+        V_ID i1 = polygons[i][(j + 1) % size];
+
+        std::size_t& nb = nb_edges[offsets[i] + j];
+        typename Internal_map_type::const_iterator em_it = edges[i0].find(i1);
+        if (em_it != edges[i0].end()) nb += em_it->second.size();
+        em_it = edges[i1].find(i0);
+        if (em_it != edges[i1].end()) nb += em_it->second.size();
+      }
+    });
+
+    marked_edges.clear();
+    for (P_ID i = 0; i < nb_polygons; ++i)
+    {
+      const P_ID size = polygons[i].size();
+      for (P_ID j = 0; j < size; ++j) {
+        if (nb_edges[offsets[i] + j] > 2)
+        {
+          V_ID i0 = polygons[i][j];
+          V_ID i1 = polygons[i][(j + 1) % size];
+          visitor.non_manifold_edge(i0, i1, nb_edges[offsets[i] + j]);
+          set_edge_marked(i0, i1, marked_edges);
+        }
+      }
+    }
+  }
+#endif
+
+  template <class ConcurrencyTag = Sequential_tag>
   static void fill_edge_map(Edge_map& edges, Marked_edges& marked_edges, const Polygons& polygons) {
     Visitor dum;
-    fill_edge_map(edges, marked_edges, polygons, dum);
+    fill_edge_map<ConcurrencyTag>(edges, marked_edges, polygons, dum);
   }
+  template <class ConcurrencyTag = Sequential_tag>
   void fill_edge_map()
   {
-    fill_edge_map(edges, marked_edges, polygons, visitor);
+    fill_edge_map<ConcurrencyTag>(edges, marked_edges, polygons, visitor);
   }
 
   /// We try to orient polygon consistently by walking in the dual graph, from
@@ -528,6 +617,13 @@ struct Polygon_soup_orienter
  *     \cgalParamType{a class model of `PMPPolygonSoupOrientationVisitor`}
  *     \cgalParamDefault{`Default_orientation_visitor`}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{Only the construction of the edge map is done in parallel.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * @return `true`  if the orientation operation succeeded.
@@ -550,10 +646,17 @@ bool orient_polygon_soup(PointRange& points,
     Default_orientation_visitor//default
   > ::type Visitor;
   Visitor visitor(choose_parameter<Visitor>(get_parameter(np, internal_np::visitor)));
+
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
   std::size_t inital_nb_pts = points.size();
   internal::Polygon_soup_orienter<PointRange, PolygonRange, Visitor>
       orienter(points, polygons, visitor);
-  orienter.fill_edge_map();
+  orienter.template fill_edge_map<Concurrency_tag>();
   orienter.orient();
   orienter.duplicate_singular_vertices();
 
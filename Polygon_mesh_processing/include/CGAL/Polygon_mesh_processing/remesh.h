@@ -193,6 +193,16 @@ namespace Polygon_mesh_processing {
 *                    of the vertex point map.}
 *     \cgalParamDefault{If not provided, vertices are projected on the input surface mesh.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the relaxation and projection steps should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the relaxation moves groups of non-adjacent vertices
+*                     concurrently (see `tangential_relaxation()`), so that the result can differ from
+*                     the sequential one, and the functors `allow_move_functor` and `projection_functor`
+*                     are called concurrently. Splits, collapses, and flips are always sequential.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * @sa `split_long_edges()`
@@ -281,6 +291,16 @@ void isotropic_remeshing(const FaceRange& faces
   auto shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                      internal::Allow_all_moves());
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 #if !defined(CGAL_NO_PRECONDITIONS)
   if(protect)
   {
@@ -336,9 +356,9 @@ void isotropic_remeshing(const FaceRange& faces
      remesher.collapse_short_edges(sizing, collapse_constraints);
     if(do_flip)
       remesher.flip_edges_for_valence_and_shape();
-    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian, sizing, shall_move);
+    remesher.template tangential_relaxation_impl<Concurrency_tag>(smoothing_1d, nb_laplacian, sizing, shall_move);
     if ( choose_parameter(get_parameter(np, internal_np::do_project), true) )
-      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor));
+      remesher.template project_to_surface<Concurrency_tag>(get_parameter(np, internal_np::projection_functor));
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     std::cout << std::endl;
 #endif
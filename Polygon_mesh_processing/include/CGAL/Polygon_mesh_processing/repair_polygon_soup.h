@@ -20,16 +20,24 @@
 #include <CGAL/Container_helper.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Kernel_traits.h>
+#include <CGAL/tags.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/functional/hash.hpp>
 #include <boost/range.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <ios>
 #include <map>
+#include <numeric>
 #include <set>
+#include <type_traits>
 #include <vector>
 #include <deque>
 #include <utility>
@@ -527,6 +535,13 @@ std::size_t remove_isolated_points_in_polygon_soup(PointRange& points,
 ///     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
 ///     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{In parallel, duplicate points are detected by sorting the points. The output is the same as the sequential version.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 /// \returns the number of removed points
@@ -549,15 +564,70 @@ std::size_t merge_duplicate_points_in_polygon_soup(PointRange& points,
 
   typedef typename Traits::Less_xyz_3                                             Less_xyz_3;
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type      Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   const std::size_t ini_points_n = points.size();
   std::vector<std::size_t> point_index(ini_points_n, 0);
 
-  typedef std::map<Point_3, std::size_t, Less_xyz_3>                              Unique_point_container;
-  Unique_point_container point_to_id(traits.less_xyz_3_object());
-
   std::vector<Point_3> unique_points;
   unique_points.reserve(ini_points_n);
 
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    const Less_xyz_3 less = traits.less_xyz_3_object();
+
+    // Identical points are consecutive once sorted, and the first one is its first occurrence
+    std::vector<std::size_t> sorted_ids(ini_points_n);
+    std::iota(sorted_ids.begin(), sorted_ids.end(), 0);
+    tbb::parallel_sort(sorted_ids.begin(), sorted_ids.end(),
+                       [&](const std::size_t i, const std::size_t j)
+                       {
+                         if(less(points[i], points[j]))
+                           return true;
+                         if(less(points[j], points[i]))
+                           return false;
+                         return i < j;
+                       });
+
+    std::vector<std::size_t> first_occurrence(ini_points_n);
+    tbb::parallel_for(std::size_t(0), ini_points_n, [&](const std::size_t k)
+                      {
+                        const std::size_t i = sorted_ids[k];
+                        const bool is_new = (k == 0 || less(points[sorted_ids[k-1]], points[i]));
+                        first_occurrence[i] = is_new ? i : ini_points_n;
+                      });
+    for(std::size_t k=1; k<ini_points_n; ++k)
+      if(first_occurrence[sorted_ids[k]] == ini_points_n)
+        first_occurrence[sorted_ids[k]] = first_occurrence[sorted_ids[k-1]];
+
+    // unique points are numbered in the order of their first occurrence, as in the sequential version
+    for(std::size_t i=0; i<ini_points_n; ++i)
+    {
+      if(first_occurrence[i] == i)
+      {
+        point_index[i] = unique_points.size();
+        unique_points.push_back(points[i]);
+      }
+      else
+      {
+        point_index[i] = point_index[first_occurrence[i]];
+      }
+    }
+  }
+  else
+#endif
+  {
+  typedef std::map<Point_3, std::size_t, Less_xyz_3>                              Unique_point_container;
+  Unique_point_container point_to_id(traits.less_xyz_3_object());
+
   for(std::size_t i=0; i<ini_points_n; ++i)
   {
     std::pair<typename Unique_point_container::iterator, bool> is_insert_successful =
@@ -573,9 +643,22 @@ std::size_t merge_duplicate_points_in_polygon_soup(PointRange& points,
       unique_points.push_back(points[i]);
     point_index[i] = id;
   }
+  }
 
   if(unique_points.size() != ini_points_n)
   {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(P_ID(0), P_ID(polygons.size()), [&](const P_ID polygon_index)
+                        {
+                          Polygon_3& polygon = polygons[polygon_index];
+                          for(std::size_t i=0, polygon_size = polygon.size(); i<polygon_size; ++i)
+                            polygon[i] = point_index[polygon[i]];
+                        });
+    }
+    else
+#endif
     for(P_ID polygon_index=0, end=polygons.size(); polygon_index!=end; ++polygon_index)
     {
       Polygon_3& polygon = polygons[polygon_index];
@@ -838,8 +921,12 @@ struct Duplicate_collector<ValueType, CGAL::Emptyset_iterator>
 // \param traits an instance of traits
 // \param same_orientation whether two polygons should have the same orientation to be duplicates.
 //
+// With `ConcurrencyTag = CGAL::Parallel_tag`, the canonical polygons are computed in parallel,
+// and duplicates are found by sorting the polygons by hash value rather than with a hash set.
+//
 // \sa `repair_polygon_soup()`
-template <typename PointRange, typename PolygonRange, typename DuplicateOutputIterator, typename Traits>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PointRange, typename PolygonRange, typename DuplicateOutputIterator, typename Traits>
 DuplicateOutputIterator collect_duplicate_polygons(const PointRange& points,
                                                    const PolygonRange& polygons,
                                                    DuplicateOutputIterator out,
@@ -854,12 +941,86 @@ DuplicateOutputIterator collect_duplicate_polygons(const PointRange& points,
                                             Reversed_markers, Traits>             Equality;
   typedef std::unordered_set<P_ID, Hasher, Equality>                              Unique_polygons;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   const std::size_t polygons_n = polygons.size();
 
   // We want the hash function to return the same value if the polygons are the same,
   // regardless of circular permutations and different orientations.
   PolygonRange canonical_polygons(polygons_n);
   Reversed_markers is_reversed(polygons_n, 0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    typedef std::pair<std::size_t, P_ID>                                          Hash_and_id;
+
+    std::vector<char> reversed_flags(polygons_n, 0);
+    tbb::parallel_for(P_ID(0), P_ID(polygons_n), [&](const P_ID polygon_index)
+                      {
+                        bool reversed;
+                        canonical_polygons[polygon_index] =
+                          internal::construct_canonical_polygon(points, polygons[polygon_index], reversed, traits);
+                        reversed_flags[polygon_index] = reversed;
+                      });
+    for(P_ID polygon_index=0; polygon_index!=P_ID(polygons_n); ++polygon_index)
+      if(reversed_flags[polygon_index])
+        is_reversed.set(polygon_index);
+
+    Hasher hash(points, canonical_polygons);
+    Equality equal(points, canonical_polygons, is_reversed, traits, same_orientation);
+
+    std::vector<Hash_and_id> keys(polygons_n);
+    tbb::parallel_for(P_ID(0), P_ID(polygons_n), [&](const P_ID polygon_index)
+                      {
+                        keys[polygon_index] = Hash_and_id(hash(polygon_index), polygon_index);
+                      });
+
+    // duplicates are consecutive once sorted, with the smallest id first in each group
+    tbb::parallel_sort(keys.begin(), keys.end(),
+                       [&](const Hash_and_id& k1, const Hash_and_id& k2)
+                       {
+                         if(k1.first != k2.first)
+                           return k1.first < k2.first;
+
+                         const auto& c1 = canonical_polygons[k1.second];
+                         const auto& c2 = canonical_polygons[k2.second];
+                         if(std::lexicographical_compare(c1.begin(), c1.end(), c2.begin(), c2.end()))
+                           return true;
+                         if(std::lexicographical_compare(c2.begin(), c2.end(), c1.begin(), c1.end()))
+                           return false;
+
+                         if(same_orientation && reversed_flags[k1.second] != reversed_flags[k2.second])
+                           return reversed_flags[k1.second] < reversed_flags[k2.second];
+
+                         return k1.second < k2.second;
+                       });
+
+    Duplicate_collector<P_ID, DuplicateOutputIterator> duplicates;
+    std::size_t group_start = 0;
+    for(std::size_t k=1; k<polygons_n; ++k)
+    {
+      if(keys[k].first == keys[group_start].first && equal(keys[group_start].second, keys[k].second))
+      {
+#ifdef CGAL_PMP_REPAIR_POLYGON_SOUP_VERBOSE_PP
+        std::cout << "polygon: " << keys[k].second << " is a duplicate of polygon: " << keys[group_start].second << std::endl;
+#endif
+        duplicates.collect_duplicates(keys[group_start].second, keys[k].second);
+      }
+      else
+      {
+        group_start = k;
+      }
+    }
+
+    duplicates.dump(out);
+    return out;
+  }
+#endif
+
   for(P_ID polygon_index=0, end=polygons.size(); polygon_index!=end; ++polygon_index)
   {
     bool reversed;
@@ -938,6 +1099,13 @@ DuplicateOutputIterator collect_duplicate_polygons(const PointRange& points,
 ///     \cgalParamType{Boolean}
 ///     \cgalParamDefault{`false`}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{In parallel, duplicate polygons are detected by sorting the polygons by hash value.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 /// \returns the number of removed polygons
@@ -964,8 +1132,13 @@ std::size_t merge_duplicate_polygons_in_polygon_soup(const PointRange& points,
   typedef typename internal::GetPolygonGeomTraits<PointRange, PolygonRange, NamedParameters>::type Traits;
   Traits traits = choose_parameter<Traits>(get_parameter(np, internal_np::geom_traits));
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       NamedParameters,
+                                                       Sequential_tag>::type                        Concurrency_tag;
+
   std::deque<std::vector<P_ID> > all_duplicate_polygons;
-  internal::collect_duplicate_polygons(points, polygons, std::back_inserter(all_duplicate_polygons), traits, same_orientation);
+  internal::collect_duplicate_polygons<Concurrency_tag>(points, polygons, std::back_inserter(all_duplicate_polygons),
+                                                        traits, same_orientation);
 
   if(all_duplicate_polygons.empty())
     return 0;
@@ -1160,6 +1333,13 @@ struct Polygon_soup_fixer<PointRange, PolygonRange, std::array<PID, N> >
 ///     \cgalParamType{Boolean}
 ///     \cgalParamDefault{`false`}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{The tag is used to merge duplicate points and duplicate polygons.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 template <typename PointRange, typename PolygonRange, typename NamedParameters = parameters::Default_named_parameters>
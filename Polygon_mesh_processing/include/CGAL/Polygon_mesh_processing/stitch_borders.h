@@ -29,16 +29,25 @@
 #include <CGAL/assertions.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/Union_find.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 #include <CGAL/use.h>
 
 #include <boost/range.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <numeric>
 #include <set>
+#include <tuple>
 #include <unordered_set>
 #include <unordered_map>
 #include <utility>
@@ -379,6 +388,86 @@ void fill_pairs(const Halfedge& he,
   }
 }
 
+// Same as calling `fill_pairs()` on each halfedge of `border_hedges`, but geometrically identical
+// halfedges are found by sorting the halfedges (in parallel if `ConcurrencyTag` is `Parallel_tag`)
+// rather than by inserting them in a map. The pairs are created in the same order as with `fill_pairs()`.
+template<typename ConcurrencyTag,
+         typename Halfedge,
+         typename Halfedge_pair,
+         typename Manifold_halfedge_pair,
+         typename Mesh,
+         typename VPM,
+         typename GT>
+void fill_pairs_by_sorting(const std::vector<Halfedge>& border_hedges,
+                           Halfedge_pair& halfedge_pairs,
+                           Manifold_halfedge_pair& manifold_halfedge_pairs,
+                           const Mesh& pmesh,
+                           VPM vpm,
+                           const GT& gt)
+{
+  typename GT::Equal_3 equal = gt.equal_3_object();
+  Less_for_halfedge<Mesh, VPM, GT> less_hedge(pmesh, vpm, gt);
+
+  const std::size_t nb_hedges = border_hedges.size();
+  std::vector<std::size_t> sorted_ids(nb_hedges);
+  std::iota(sorted_ids.begin(), sorted_ids.end(), 0);
+
+  // ties are broken with the position in the range, so that the first halfedge of a group
+  // is the one that would have been inserted in the map
+  auto less = [&](const std::size_t i, const std::size_t j)
+  {
+    if(less_hedge(border_hedges[i], border_hedges[j]))
+      return true;
+    if(less_hedge(border_hedges[j], border_hedges[i]))
+      return false;
+    return i < j;
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    tbb::parallel_sort(sorted_ids.begin(), sorted_ids.end(), less);
+  else
+#endif
+    std::sort(sorted_ids.begin(), sorted_ids.end(), less);
+
+  // a pair is created when the second halfedge of a group is met
+  typedef std::tuple<std::size_t, Halfedge, Halfedge, bool>                     Pair_with_position;
+  std::vector<Pair_with_position> pairs;
+
+  std::size_t group_start = 0;
+  for(std::size_t k=1; k<=nb_hedges; ++k)
+  {
+    if(k < nb_hedges && !less_hedge(border_hedges[sorted_ids[group_start]], border_hedges[sorted_ids[k]]))
+      continue;
+
+    if(k - group_start >= 2)
+    {
+      const Halfedge other_he = border_hedges[sorted_ids[group_start]];
+      const Halfedge he = border_hedges[sorted_ids[group_start + 1]];
+
+      // Even if the halfedges are compatible, refuse to stitch if that would break the graph
+      const bool is_manifold = (k - group_start == 2) &&
+                               equal(get(vpm, source(he,pmesh)), get(vpm, target(other_he, pmesh))) &&
+                               equal(get(vpm, target(he,pmesh)), get(vpm, source(other_he, pmesh))) &&
+                               face(opposite(he, pmesh), pmesh) != face(opposite(other_he, pmesh), pmesh);
+
+      pairs.emplace_back(sorted_ids[group_start + 1], other_he, he, is_manifold);
+    }
+
+    group_start = k;
+  }
+
+  std::sort(pairs.begin(), pairs.end(),
+            [](const Pair_with_position& p1, const Pair_with_position& p2)
+            { return std::get<0>(p1) < std::get<0>(p2); });
+
+  for(const Pair_with_position& p : pairs)
+  {
+    halfedge_pairs.emplace_back(std::get<1>(p), std::get<2>(p));
+    manifold_halfedge_pairs.push_back(std::get<3>(p));
+  }
+}
+
 template <typename HalfedgeRange,
           typename PolygonMesh,
           typename HalfedgeKeeper,
@@ -403,6 +492,17 @@ OutputIterator collect_duplicated_stitchable_boundary_edges(const HalfedgeRange&
   typedef typename GetGeomTraits<PolygonMesh, CGAL_NP_CLASS>::type GT;
   GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                       CGAL_NP_CLASS,
+                                                       Sequential_tag>::type      Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  const bool parallel = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
   typedef CGAL::dynamic_face_property_t<int>                                      Face_property_tag;
   typedef typename boost::property_map<PolygonMesh, Face_property_tag>::type      Face_cc_map;
 
@@ -419,6 +519,9 @@ OutputIterator collect_duplicated_stitchable_boundary_edges(const HalfedgeRange&
   std::vector<std::pair<halfedge_descriptor, halfedge_descriptor> > halfedge_pairs;
   std::vector<bool> manifold_halfedge_pairs;
 
+  // used by the parallel version, which sorts the border halfedges instead of using the map
+  std::vector<halfedge_descriptor> border_hedges;
+
 #ifdef CGAL_PMP_STITCHING_DEBUG
   std::cout << "Collecting stitchable pair from a hrange of size: " << halfedge_range.size()
             << " (total: " << halfedges(pmesh).size() << ")" << std::endl;
@@ -443,23 +546,54 @@ OutputIterator collect_duplicated_stitchable_boundary_edges(const HalfedgeRange&
 
     if(per_cc)
       border_edges_per_cc[get(cc, face(opposite(he, pmesh), pmesh))].push_back(he);
+    else if(parallel)
+      border_hedges.push_back(he);
     else
       fill_pairs(he, border_halfedge_map, halfedge_pairs, manifold_halfedge_pairs, pmesh, vpm, gt);
   }
 
+  if(!per_cc && parallel)
+    fill_pairs_by_sorting<Concurrency_tag>(border_hedges, halfedge_pairs, manifold_halfedge_pairs, pmesh, vpm, gt);
+
   if(per_cc)
   {
+    // In parallel, the connected components are processed concurrently
+    std::vector<std::vector<std::pair<halfedge_descriptor, halfedge_descriptor> > > halfedge_pairs_per_cc;
+    std::vector<std::vector<bool> > manifold_halfedge_pairs_per_cc;
+#ifdef CGAL_LINKED_WITH_TBB
+    if(parallel)
+    {
+      halfedge_pairs_per_cc.resize(num_cc);
+      manifold_halfedge_pairs_per_cc.resize(num_cc);
+      tbb::parallel_for(std::size_t(0), num_cc, [&](const std::size_t i)
+                        {
+                          fill_pairs_by_sorting<Sequential_tag>(border_edges_per_cc[i],
+                                                                halfedge_pairs_per_cc[i],
+                                                                manifold_halfedge_pairs_per_cc[i],
+                                                                pmesh, vpm, gt);
+                        });
+    }
+#endif
+
     for(std::size_t i=0; i<num_cc; ++i)
     {
       CGAL_assertion(halfedge_pairs.empty());
       CGAL_assertion(manifold_halfedge_pairs.empty());
 
-      Border_halfedge_map border_halfedge_map_in_cc(less_hedge);
-      for(std::size_t j=0; j<border_edges_per_cc[i].size(); ++j)
+      if(parallel)
+      {
+        halfedge_pairs.swap(halfedge_pairs_per_cc[i]);
+        manifold_halfedge_pairs.swap(manifold_halfedge_pairs_per_cc[i]);
+      }
+      else
       {
-        halfedge_descriptor he = border_edges_per_cc[i][j];
-        fill_pairs(he, border_halfedge_map_in_cc, halfedge_pairs,
-                   manifold_halfedge_pairs, pmesh, vpm, gt);
+        Border_halfedge_map border_halfedge_map_in_cc(less_hedge);
+        for(std::size_t j=0; j<border_edges_per_cc[i].size(); ++j)
+        {
+          halfedge_descriptor he = border_edges_per_cc[i][j];
+          fill_pairs(he, border_halfedge_map_in_cc, halfedge_pairs,
+                     manifold_halfedge_pairs, pmesh, vpm, gt);
+        }
       }
 
       // put in `out` only manifold edges from the set of edges to stitch.
@@ -1427,6 +1561,15 @@ std::size_t stitch_borders(const BorderHalfedgeRange& boundary_cycle_representat
 ///                    as key type and `std::size_t` as value type}
 ///     \cgalParamDefault{an automatically indexed internal map}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{In parallel, the halfedges to stitch are matched by sorting the border halfedges
+///                     (per connected component if `apply_per_connected_component` is `true`).
+///                     The halfedges that are stitched are the same as in the sequential version.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 /// \return the number of pairs of halfedges that were stitched.
@@ -1499,6 +1642,15 @@ std::size_t stitch_borders(PolygonMesh& pmesh,
 ///     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
 ///     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 ///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///     \cgalParamExtra{In parallel, the halfedges to stitch are matched by sorting the border halfedges
+///                     (per connected component if `apply_per_connected_component` is `true`).
+///                     The halfedges that are stitched are the same as in the sequential version.}
+///   \cgalParamNEnd
 /// \cgalNamedParamsEnd
 ///
 /// \return the number of pairs of halfedges that were stitched.
@@ -22,10 +22,16 @@
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -123,6 +129,15 @@ struct Allow_all_moves{
 *     \cgalParamDefault{If not provided, smoothing weights are the same for all vertices.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the vertices are moved by groups of non-adjacent vertices,
+*                     so the result can differ from the sequential one. The property maps and
+*                     the functor `allow_move_functor` are then accessed concurrently.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
@@ -177,6 +192,18 @@ void tangential_relaxation(const VertexRange& vertices,
   const bool relax_constraints = choose_parameter(get_parameter(np, internal_np::relax_constraints), false);
   const unsigned int nb_iterations = choose_parameter(get_parameter(np, internal_np::number_of_iterations), 1);
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      CGAL_NP_CLASS,
+      Sequential_tag
+    > ::type Concurrency_tag;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  constexpr bool parallel_execution = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+#endif
+
   typedef typename GT::Vector_3 Vector_3;
   typedef typename GT::Point_3 Point_3;
 
@@ -226,112 +253,168 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
-  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
-  {
-#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
-    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
-    std::cout << nb_iterations << ") ";
-    std::cout.flush();
-#endif
+  typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
+  typedef std::pair<vertex_descriptor, Point_3> VP_pair;
 
-    typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
-    std::vector< VNP > barycenters;
-    auto gt_barycenter = gt.construct_barycenter_3_object();
-    auto gt_project = gt.construct_projected_point_3_object();
+  auto gt_barycenter = gt.construct_barycenter_3_object();
+  auto gt_project = gt.construct_projected_point_3_object();
 
-    // at each vertex, compute vertex normal
-    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+  // computes the barycenter of the neighbors of `v`, returns `false` if `v` does not move
+  auto compute_barycenter = [&](vertex_descriptor v, const auto& vertex_normal, VNP& vnp)
+  {
+    if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
+      return false;
 
-    // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    // collect hedges to detect if we have to handle boundary cases
+    std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
+    for(halfedge_descriptor h : halfedges_around_target(v, tm))
     {
-      if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
-
-      // collect hedges to detect if we have to handle boundary cases
-      std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
-      for(halfedge_descriptor h : halfedges_around_target(v, tm))
-      {
-        if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
-          border_halfedges.push_back(h);
-        else
-          interior_hedges.push_back(h);
-      }
+      if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
+        border_halfedges.push_back(h);
+      else
+        interior_hedges.push_back(h);
+    }
 
-      if (border_halfedges.empty())
+    if (border_halfedges.empty())
+    {
+      const Vector_3 vn = vertex_normal(v);
+      Vector_3 move = CGAL::NULL_VECTOR;
+      if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
       {
-        const Vector_3& vn = vnormals.at(v);
-        Vector_3 move = CGAL::NULL_VECTOR;
-        if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
-        {
-          unsigned int star_size = 0;
-          for(halfedge_descriptor h :interior_hedges)
-          {
-            move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
-            ++star_size;
-          }
-          CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
-          move = (1. / static_cast<double>(star_size)) * move;
-        }
-        else
+        unsigned int star_size = 0;
+        for(halfedge_descriptor h :interior_hedges)
         {
-          auto gt_centroid = gt.construct_centroid_3_object();
-          auto gt_area = gt.compute_area_3_object();
-          double weight = 0;
-          for(halfedge_descriptor h :interior_hedges)
-          {
-            // calculate weight
-            // need v, v1 and v2
-            const vertex_descriptor v1 = target(next(h, tm), tm);
-            const vertex_descriptor v2 = source(h, tm);
-
-            const double tri_area = gt_area(get(vpm, v), get(vpm, v1), get(vpm, v2));
-            const double face_weight = tri_area
-                                       / (1. / 3. * (sizing.at(v, tm)
-                                                   + sizing.at(v1, tm)
-                                                   + sizing.at(v2, tm)));
-            weight += face_weight;
-
-            const Point_3 centroid = gt_centroid(get(vpm, v), get(vpm, v1), get(vpm, v2));
-            move = move + Vector_3(get(vpm, v), centroid) * face_weight;
-          }
-          move = move / weight; //todo ip: what if weight ends up being close to 0?
+          move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
+          ++star_size;
         }
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
+        move = (1. / static_cast<double>(star_size)) * move;
       }
       else
       {
-        if (!relax_constraints) continue;
-        Vector_3 vn(NULL_VECTOR);
-
-        if (border_halfedges.size() == 2)// corners are constrained
+        auto gt_centroid = gt.construct_centroid_3_object();
+        auto gt_area = gt.compute_area_3_object();
+        double weight = 0;
+        for(halfedge_descriptor h :interior_hedges)
         {
-          vertex_descriptor ph0 = source(border_halfedges[0], tm);
-          vertex_descriptor ph1 = source(border_halfedges[1], tm);
-          double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
-                                 * Vector_3(get(vpm, v), get(vpm, ph1)));
-          // \todo shouldn't it be an input parameter?
-          //check squared cosine is < 0.25 (~120 degrees)
-          if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
-                                 squared_distance(get(vpm,ph1), get(vpm, v))) )
-          {
-            typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
-            // to avoid shrinking of borders, we project back onto the incident segments
-            typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
-                                   s2(get(vpm, ph1), get(vpm,v));
-
-            typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
-
-            bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
-          }
+          // calculate weight
+          // need v, v1 and v2
+          const vertex_descriptor v1 = target(next(h, tm), tm);
+          const vertex_descriptor v2 = source(h, tm);
+
+          const double tri_area = gt_area(get(vpm, v), get(vpm, v1), get(vpm, v2));
+          const double face_weight = tri_area
+                                     / (1. / 3. * (sizing.at(v, tm)
+                                                 + sizing.at(v1, tm)
+                                                 + sizing.at(v2, tm)));
+          weight += face_weight;
+
+          const Point_3 centroid = gt_centroid(get(vpm, v), get(vpm, v1), get(vpm, v2));
+          move = move + Vector_3(get(vpm, v), centroid) * face_weight;
         }
+        move = move / weight; //todo ip: what if weight ends up being close to 0?
       }
+      vnp = VNP(v, vn, get(vpm, v) + move);
+      return true;
+    }
+
+    if (!relax_constraints) return false;
+    Vector_3 vn(NULL_VECTOR);
+
+    if (border_halfedges.size() == 2)// corners are constrained
+    {
+      vertex_descriptor ph0 = source(border_halfedges[0], tm);
+      vertex_descriptor ph1 = source(border_halfedges[1], tm);
+      double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
+                             * Vector_3(get(vpm, v), get(vpm, ph1)));
+      // \todo shouldn't it be an input parameter?
+      //check squared cosine is < 0.25 (~120 degrees)
+      if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
+                             squared_distance(get(vpm,ph1), get(vpm, v))) )
+      {
+        typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
+        // to avoid shrinking of borders, we project back onto the incident segments
+        typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
+                               s2(get(vpm, ph1), get(vpm,v));
+
+        typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
+
+        bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
+        vnp = VNP(v, vn, bary);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // moves `vp.first` to `vp.second`, shortening the move if a face gets inverted
+  auto perform_move = [&](const VP_pair& vp)
+  {
+    const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
+    const Vector_3 move(initial_pos, vp.second);
+
+    put(vpm, vp.first, vp.second);
+
+    //check that no inversion happened
+    double frac = 1.;
+    while (frac > 0.03 //5 attempts maximum
+           && (   !check_normals(vp.first)
+                  || !shall_move(vp.first, initial_pos, get(vpm, vp.first)))) //if a face has been inverted
+    {
+      frac = 0.5 * frac;
+      put(vpm, vp.first, initial_pos + frac * move);//shorten the move by 2
+    }
+    if (frac <= 0.02)
+      put(vpm, vp.first, initial_pos);//cancel move
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::vector<vertex_descriptor> vertex_vector;
+  if constexpr (parallel_execution)
+    vertex_vector.assign(std::begin(vertices), std::end(vertices));
+#endif
+
+  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
+  {
+#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
+    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
+    std::cout << nb_iterations << ") ";
+    std::cout.flush();
+#endif
+
+    std::vector< VNP > barycenters;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (parallel_execution)
+    {
+      // at each vertex, compute vertex normal and barycenter of neighbors
+      auto vertex_normal = [&](vertex_descriptor v) { return compute_vertex_normal(v, tm, np); };
+      std::vector<VNP> all_barycenters(vertex_vector.size());
+      std::vector<char> moves(vertex_vector.size());
+      tbb::parallel_for(std::size_t(0), vertex_vector.size(), [&](std::size_t i)
+      {
+        moves[i] = compute_barycenter(vertex_vector[i], vertex_normal, all_barycenters[i]);
+      });
+      for (std::size_t i=0; i<vertex_vector.size(); ++i)
+        if (moves[i])
+          barycenters.push_back(all_barycenters[i]);
+    }
+    else
+#endif
+    {
+      // at each vertex, compute vertex normal
+      std::unordered_map<vertex_descriptor, Vector_3> vnormals;
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+      auto vertex_normal = [&](vertex_descriptor v) { return vnormals.at(v); };
+
+      // at each vertex, compute barycenter of neighbors
+      VNP vnp;
+      for(vertex_descriptor v : vertices)
+        if (compute_barycenter(v, vertex_normal, vnp))
+          barycenters.push_back(vnp);
     }
 
     // compute moves
-    typedef std::pair<vertex_descriptor, Point_3> VP_pair;
     std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
     new_locations.reserve(barycenters.size());
     for(const VNP& vnp : barycenters)
@@ -345,24 +428,48 @@ void tangential_relaxation(const VertexRange& vertices,
     }
 
     // perform moves
-    for(const VP_pair& vp : new_locations)
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (parallel_execution)
     {
-      const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
-      const Vector_3 move(initial_pos, vp.second);
-
-      put(vpm, vp.first, vp.second);
-
-      //check that no inversion happened
-      double frac = 1.;
-      while (frac > 0.03 //5 attempts maximum
-             && (   !check_normals(vp.first)
-                    || !shall_move(vp.first, initial_pos, get(vpm, vp.first)))) //if a face has been inverted
+      // The validity of a move is checked on the faces incident to the moved vertex,
+      // so adjacent vertices cannot be moved concurrently: the moved vertices
+      // are greedily colored and the vertices of a color are moved concurrently.
+      std::unordered_map<vertex_descriptor, std::size_t> moved_vertex_index;
+      for (std::size_t i=0; i<new_locations.size(); ++i)
+        moved_vertex_index.emplace(new_locations[i].first, i);
+
+      std::vector<std::size_t> colors(new_locations.size());
+      std::vector<std::vector<std::size_t> > color_classes;
+      std::vector<bool> used_colors;
+      for (std::size_t i=0; i<new_locations.size(); ++i)
       {
-        frac = 0.5 * frac;
-        put(vpm, vp.first, initial_pos + frac * move);//shorten the move by 2
+        used_colors.assign(color_classes.size(), false);
+        for (halfedge_descriptor h : halfedges_around_target(new_locations[i].first, tm))
+        {
+          auto it = moved_vertex_index.find(source(h, tm));
+          if (it != moved_vertex_index.end() && it->second < i)
+            used_colors[colors[it->second]] = true;
+        }
+        std::size_t c = 0;
+        while (c < used_colors.size() && used_colors[c])
+          ++c;
+        if (c == color_classes.size())
+          color_classes.emplace_back();
+        colors[i] = c;
+        color_classes[c].push_back(i);
       }
-      if (frac <= 0.02)
-        put(vpm, vp.first, initial_pos);//cancel move
+
+      for (const std::vector<std::size_t>& color_class : color_classes)
+        tbb::parallel_for(std::size_t(0), color_class.size(), [&](std::size_t i)
+        {
+          perform_move(new_locations[color_class[i]]);
+        });
+    }
+    else
+#endif
+    {
+      for(const VP_pair& vp : new_locations)
+        perform_move(vp);
     }
   }//end for loop (nit == nb_iterations)
 
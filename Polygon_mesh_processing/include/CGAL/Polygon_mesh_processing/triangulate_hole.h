@@ -26,9 +26,16 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/tags.h>
 
-#include <tuple>
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
 
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -60,6 +67,150 @@ namespace Polygon_mesh_processing {
     };
   } // namespace Hole_filling
 
+namespace internal {
+
+  // the maximum squared distance between the boundary of a hole and its fitting plane
+  // for the hole to be filled using the 2D constrained Delaunay triangulation
+  template <typename GeomTraits, typename PointRange, typename NamedParameters>
+  typename GeomTraits::FT
+  cdt_max_squared_distance(const PointRange& points, const NamedParameters& np)
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
+    typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
+    default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
+
+    const typename GeomTraits::FT threshold_distance = choose_parameter(
+      get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
+    typename GeomTraits::FT max_squared_distance = default_squared_distance;
+    if (threshold_distance >= typename GeomTraits::FT(0))
+      max_squared_distance = threshold_distance * threshold_distance;
+    CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
+    return max_squared_distance;
+  }
+
+  // Fills the holes incident to the halfedges of `border_halfedges`:
+  // the boundaries of all the holes are first read and triangulated (concurrently
+  // with `Parallel_tag`) without modifying the mesh, then the patches are added
+  // to the mesh and refined one after the other.
+  // If `patch_vertices` is not null, the vertices created by the refinement of
+  // each filled hole are put in `*patch_vertices`.
+  // Returns the number of holes filled.
+  template <typename PolygonMesh,
+            typename HalfedgeRange,
+            typename NamedParameters>
+  std::size_t
+  triangulate_holes_impl(PolygonMesh& pmesh,
+                         const HalfedgeRange& border_halfedges,
+                         const bool refine_patches,
+                         std::vector<std::vector<typename boost::graph_traits<PolygonMesh>::vertex_descriptor> >* patch_vertices,
+                         const NamedParameters& np)
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor   vertex_descriptor;
+    typedef typename boost::graph_traits<PolygonMesh>::face_descriptor     face_descriptor;
+
+    typedef typename GetGeomTraits<PolygonMesh, NamedParameters>::type     GeomTraits;
+    typedef typename GeomTraits::Point_3                                   Point_3;
+    typedef typename GetVertexPointMap<PolygonMesh, NamedParameters>::type VPMap;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         NamedParameters,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+    typedef typename internal_np::Lookup_named_param_def<internal_np::vertex_output_iterator_t,
+                                                         NamedParameters,
+                                                         Emptyset_iterator>::type Vertex_output_iterator;
+
+    Face_output_iterator face_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+    Vertex_output_iterator vertex_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::vertex_output_iterator));
+
+    VPMap vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+    const GeomTraits gt = choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits));
+
+    const bool use_dt3 =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_DT3
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_delaunay_triangulation), true);
+#endif
+    const bool use_cdt =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
+#endif
+    const bool skip_cubic_algorithm = choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false);
+
+    const std::vector<halfedge_descriptor> hedges(std::begin(border_halfedges), std::end(border_halfedges));
+    const std::size_t nb_holes = hedges.size();
+
+    std::vector<Hole_boundary<PolygonMesh, Point_3> > holes(nb_holes);
+    std::vector<Tracer_lookup_table_recorder> triangulations(nb_holes);
+
+    auto triangulate = [&](std::size_t i)
+    {
+      CGAL_precondition(face(hedges[i], pmesh) == boost::graph_traits<PolygonMesh>::null_face());
+      if(!read_hole_boundary(pmesh, hedges[i], vpmap, holes[i]))
+        return;
+
+      const typename GeomTraits::FT max_squared_distance =
+        use_cdt ? cdt_max_squared_distance<GeomTraits>(holes[i].P, np) : typename GeomTraits::FT(-1);
+      Hole_filling::Default_visitor visitor;
+      triangulate_hole_boundary(holes[i], triangulations[i], use_dt3, gt,
+                                use_cdt, skip_cubic_algorithm, visitor, max_squared_distance);
+    };
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+      tbb::parallel_for(std::size_t(0), nb_holes, triangulate);
+    else
+#endif
+      for(std::size_t i=0; i<nb_holes; ++i)
+        triangulate(i);
+
+    // the patches are added to the mesh sequentially
+    std::size_t nb_filled = 0;
+    std::vector<face_descriptor> patch;
+    std::vector<vertex_descriptor> new_vertices;
+    for(std::size_t i=0; i<nb_holes; ++i)
+    {
+      if(!triangulations[i].is_traced)
+        continue;
+      ++nb_filled;
+
+      patch.clear();
+      Tracer_polyhedron<PolygonMesh, std::back_insert_iterator<std::vector<face_descriptor> > >
+        tracer(std::back_inserter(patch), pmesh, holes[i].P_edges);
+      tracer(triangulations[i], 0, triangulations[i].last);
+      face_out = std::copy(patch.begin(), patch.end(), face_out);
+
+      if(!refine_patches)
+        continue;
+
+      new_vertices.clear();
+      face_out = refine(pmesh, patch, face_out, std::back_inserter(new_vertices), np).first;
+      vertex_out = std::copy(new_vertices.begin(), new_vertices.end(), vertex_out);
+      if(patch_vertices != nullptr)
+        patch_vertices->push_back(new_vertices);
+    }
+
+    return nb_filled;
+  }
+
+} // namespace internal
+
   /*!
   \ingroup PMP_hole_filling_grp
 
@@ -206,16 +357,7 @@ namespace Polygon_mesh_processing {
         points.push_back(get(vpmap, target(*circ, pmesh)));
       } while (++circ != done);
 
-      const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
-      typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
-      default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
-
-      const typename GeomTraits::FT threshold_distance = choose_parameter(
-        get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
-      max_squared_distance = default_squared_distance;
-      if (threshold_distance >= typename GeomTraits::FT(0))
-        max_squared_distance = threshold_distance * threshold_distance;
-      CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
+      max_squared_distance = internal::cdt_max_squared_distance<GeomTraits>(points, np);
     }
 
     Hole_filling::Default_visitor default_visitor;
@@ -635,6 +777,150 @@ namespace Polygon_mesh_processing {
   }
 #endif // CGAL_NO_DEPRECATED_CODE
 
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  triangulates the holes of a polygon mesh.
+
+  Each hole is triangulated as with `triangulate_hole()`. The triangulations of all the holes
+  are first computed without modifying the mesh, which allows to compute them concurrently,
+  and then the patches are added to the mesh one after the other.
+  Holes that cannot be triangulated are left untouched.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a model of `Range` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range with one border halfedge per hole, each hole being given at most once
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters",
+            among the ones of `triangulate_hole()` (except `visitor`) and the one listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{The output does not depend on the tag.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @return the number of holes filled
+
+  \sa `CGAL::Polygon_mesh_processing::extract_boundary_cycles()`
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::size_t
+  triangulate_holes(PolygonMesh& pmesh,
+                    const HalfedgeRange& border_halfedges,
+                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    return internal::triangulate_holes_impl(pmesh, border_halfedges, false, nullptr, np);
+  }
+
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  @brief triangulates and refines the holes of a polygon mesh.
+
+  The holes are triangulated as with `triangulate_holes()`, and then
+  each patch is refined as with `triangulate_and_refine_hole()`.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a model of `Range` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range with one border halfedge per hole, each hole being given at most once
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters",
+            among the ones of `triangulate_and_refine_hole()` (except `visitor`) and the one listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{Only the triangulations of the holes are computed concurrently,
+                      the refinement of the patches is sequential. The output does not depend on the tag.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @return the number of holes filled
+
+  \sa `CGAL::Polygon_mesh_processing::triangulate_holes()`
+  \sa `CGAL::Polygon_mesh_processing::refine()`
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::size_t
+  triangulate_and_refine_holes(PolygonMesh& pmesh,
+                               const HalfedgeRange& border_halfedges,
+                               const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    return internal::triangulate_holes_impl(pmesh, border_halfedges, true, nullptr, np);
+  }
+
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  @brief triangulates, refines and fairs the holes of a polygon mesh.
+
+  The holes are triangulated and refined as with `triangulate_and_refine_holes()`,
+  and then the vertices of each patch are faired as with `triangulate_refine_and_fair_hole()`.
+  The new positions of the vertices of all the patches are computed before any vertex is moved,
+  so that the fairing of a patch does not depend on the fairing of the other patches.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a model of `Range` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range with one border halfedge per hole, each hole being given at most once
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters",
+            among the ones of `triangulate_refine_and_fair_hole()` (except `visitor`) and the one listed below
+
+  \cgalNamedParamsBegin
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{The triangulations of the holes and the fairing of the patches are computed concurrently,
+                      the refinement of the patches is sequential. In parallel, each fairing uses
+                      a default constructed instance of the type of `sparse_linear_solver`.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @return a pair with the number of holes filled and the number of patches successfully faired
+
+  \sa `CGAL::Polygon_mesh_processing::triangulate_and_refine_holes()`
+  \sa `CGAL::Polygon_mesh_processing::fair()`
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::pair<std::size_t, std::size_t>
+  triangulate_refine_and_fair_holes(PolygonMesh& pmesh,
+                                    const HalfedgeRange& border_halfedges,
+                                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    CGAL_precondition(CGAL::is_triangle_mesh(pmesh));
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+    std::vector<std::vector<typename boost::graph_traits<PolygonMesh>::vertex_descriptor> > patches;
+    const std::size_t nb_filled = internal::triangulate_holes_impl(pmesh, border_halfedges, true, &patches, np);
+
+    CGAL_postcondition(CGAL::is_triangle_mesh(pmesh));
+
+    const std::size_t nb_faired = internal::fair_vertex_ranges<Concurrency_tag>(pmesh, patches, np);
+    return std::make_pair(nb_filled, nb_faired);
+  }
+
   /*!
   \ingroup PMP_hole_filling_grp
   creates triangles to fill the hole defined by points in the range `points`.
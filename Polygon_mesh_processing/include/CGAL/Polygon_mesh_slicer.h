@@ -21,6 +21,15 @@
 #include <CGAL/AABB_halfedge_graph_segment_primitive.h>
 #include <CGAL/tuple.h>
 
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
 #include <vector>
 #include <set>
 #include <type_traits>
@@ -387,6 +396,153 @@ class Polygon_mesh_slicer
     return std::pair<int,FT>(-1, 0);
   }
 
+  /// classifies the edges of `candidate_edges` with respect to `plane`, like the traversal traits
+  template <class Traits_>
+  void classify_edges(const Plane_3& plane,
+                      const Traits_& traits,
+                      const std::vector<edge_descriptor>& candidate_edges,
+                      std::set<edge_descriptor>& all_coplanar_edges,
+                      std::vector<edge_descriptor>& iedges,
+                      Vertices_map& vertices) const
+  {
+    typename Traits_::Oriented_side_3 oriented_side_3 = traits.oriented_side_3_object();
+    for (edge_descriptor ed : candidate_edges)
+    {
+      Oriented_side src = oriented_side_3(plane, get(m_vpmap, source(ed,m_tmesh)) );
+      Oriented_side tgt = oriented_side_3(plane, get(m_vpmap, target(ed,m_tmesh)) );
+
+      if (src==ON_ORIENTED_BOUNDARY)
+      {
+        if (tgt==ON_ORIENTED_BOUNDARY)
+          all_coplanar_edges.insert(ed);
+        else
+          vertices.insert( Vertex_pair (source(ed,m_tmesh), AL_graph::null_vertex()) );
+      }
+      else{
+        if (tgt==ON_ORIENTED_BOUNDARY)
+          vertices.insert( Vertex_pair (target(ed,m_tmesh), AL_graph::null_vertex()) );
+        else
+          if (src!=tgt)
+            iedges.push_back(ed);
+      }
+    }
+  }
+
+  /// builds the polylines of `plane` from the edges and vertices it intersects
+  template <class OutputIterator>
+  OutputIterator build_polylines(const Plane_3& plane,
+                                 const std::pair<int, FT>& app_info,
+                                 std::set<edge_descriptor>& all_coplanar_edges,
+                                 const std::vector<edge_descriptor>& iedges,
+                                 Vertices_map& vertices,
+                                 OutputIterator out) const
+  {
+    // init output graph
+    AL_graph al_graph;
+
+    // add nodes for each vertex in the plane
+    for(Vertex_pair& vdp : vertices)
+    {
+      vdp.second=add_vertex(al_graph);
+      al_graph[vdp.second]=vdp.first;
+    }
+
+    Compare_face less_face(m_tmesh);
+    AL_edge_map al_edge_map( less_face );
+
+    // Filter coplanar edges: we consider only coplanar edges incident to one non-coplanar facet
+    //   for each such edge, add the corresponding nodes in the adjacency-list graph as well as
+    //   the edge
+    for(const edge_descriptor ed : all_coplanar_edges)
+    {
+      if (  face(halfedge(ed, m_tmesh), m_tmesh)==graph_traits::null_face() ||
+            opposite_face(ed)==graph_traits::null_face()  ||
+            !all_coplanar_edges.count( next_edge(ed) ) ||
+            !all_coplanar_edges.count( next_of_opposite_edge(ed) ) )
+      {
+        typename Vertices_map::iterator it_insert1, it_insert2;
+        bool is_new;
+
+        // Each coplanar edge is connecting two nodes
+        //  handle source
+        std::tie(it_insert1, is_new) =
+          vertices.insert(
+              Vertex_pair(
+                source(ed,m_tmesh), AL_graph::null_vertex()
+              )
+          );
+        if (is_new)
+        {
+          it_insert1->second=add_vertex(al_graph);
+          al_graph[it_insert1->second]=it_insert1->first;
+        }
+        //  handle target
+        std::tie(it_insert2, is_new) =
+          vertices.insert(
+              Vertex_pair(
+                target(ed,m_tmesh), AL_graph::null_vertex()
+              )
+          );
+        if (is_new)
+        {
+          it_insert2->second=add_vertex(al_graph);
+          al_graph[it_insert2->second]=it_insert2->first;
+        }
+        // add the edge into the adjacency-list graph
+        CGAL_assertion( it_insert1->second!=AL_graph::null_vertex() );
+        CGAL_assertion( it_insert2->second!=AL_graph::null_vertex() );
+        add_edge(it_insert1->second, it_insert2->second, al_graph);
+      }
+    }
+
+    // for each edge intersected in its interior, creates a node in
+    // an adjacency-list graph and put an edge between two such nodes
+    // when the corresponding edges shares a common face
+    for(edge_descriptor ed : iedges)
+    {
+      AL_vertex_descriptor vd=add_vertex(al_graph);
+      al_graph[vd]=ed;
+      update_al_graph_connectivity(ed, vd, al_edge_map, al_graph);
+    }
+
+    // If one of the node above is not connected in its two incident faces
+    // then it must be connected to a vertex (including those in the set
+    // of coplanar edges)
+    typedef std::pair<halfedge_descriptor, AL_vertex_pair> Halfedge_and_vertices;
+    for(Halfedge_and_vertices hnv :al_edge_map)
+    {
+      if (hnv.second.second==AL_graph::null_vertex())
+      {
+        //get the edge and test opposite vertices (if the edge is not on the boundary)
+        vertex_descriptor vd = target( next(hnv.first, m_tmesh), m_tmesh);
+        typename Vertices_map::iterator itv=vertices.find(vd);
+        CGAL_assertion( itv!=vertices.end() );
+        add_edge(itv->second, hnv.second.first, al_graph);
+      }
+    }
+
+    CGAL_assertion(num_vertices(al_graph)==iedges.size()+vertices.size());
+
+    // now assemble the edges of al_graph to define polylines,
+    // putting them in the output iterator
+    if (!UseParallelPlaneOptimization || app_info.first==-1)
+    {
+      Polyline_visitor<OutputIterator, Traits> visitor(m_tmesh, al_graph, plane, m_vpmap, m_traits, out);
+      split_graph_into_polylines(al_graph, visitor);
+      return visitor.out;
+    }
+    else
+    {
+      typedef Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits> App_traits;
+      App_traits app_traits(app_info.first, app_info.second, m_traits);
+
+      Polyline_visitor<OutputIterator, App_traits> visitor
+        (m_tmesh, al_graph, plane, m_vpmap, app_traits, out);
+      split_graph_into_polylines(al_graph, visitor);
+      return visitor.out;
+    }
+  }
+
 public:
 
   /// the AABB-tree type used internally
@@ -538,110 +694,153 @@ public:
       m_tree_ptr->traversal(plane, ttraits);
     }
 
-    // init output graph
-    AL_graph al_graph;
+    return build_polylines(plane, app_info, all_coplanar_edges, iedges, vertices, out);
+  }
 
-    // add nodes for each vertex in the plane
-    for(Vertex_pair& vdp : vertices)
+  /**
+   * Constructs the intersecting polylines of each plane of `planes` with the input triangulated surface mesh,
+   * the polylines of each plane being the same as the ones constructed by the function above.
+   *
+   * Instead of traversing the `AABB_tree` once per plane, the edges of the mesh are assigned
+   * to the range of planes they cross, using their projection on the common normal of the planes.
+   * The polylines of the different planes are then built independently, possibly in parallel.
+   * This is the function to use to slice a mesh with a large number of parallel planes.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+   *         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+   *         The default is `Sequential_tag`.
+   * @tparam PlaneRange a model of `ConstRange` with `Plane_3` as value type
+   * @tparam OutputIterator an output iterator accepting the polylines of a plane,
+   *         provided as `std::vector<std::vector<Traits::Point_3> >`.
+   * @param planes the planes to intersect the triangulated surface mesh with
+   * @param out output iterator, filled with the polylines of each plane in the order of `planes`
+   *
+   * @pre the planes of `planes` are parallel and not degenerate.
+   */
+  template <class ConcurrencyTag = Sequential_tag, class PlaneRange, class OutputIterator>
+  OutputIterator operator() (const PlaneRange& planes,
+                             OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    typedef std::vector<Point_3> Polyline;
+
+    const std::vector<Plane_3> plane_vector(std::begin(planes), std::end(planes));
+    const std::size_t nb_planes = plane_vector.size();
+    if (nb_planes == 0)
+      return out;
+
+    // the position of each plane along the normal of the first plane
+    typename Traits::Compute_a_3 compute_a = m_traits.compute_a_3_object();
+    typename Traits::Compute_b_3 compute_b = m_traits.compute_b_3_object();
+    typename Traits::Compute_c_3 compute_c = m_traits.compute_c_3_object();
+    typename Traits::Compute_d_3 compute_d = m_traits.compute_d_3_object();
+    const double n[3] = { to_double(compute_a(plane_vector[0])),
+                          to_double(compute_b(plane_vector[0])),
+                          to_double(compute_c(plane_vector[0])) };
+    const double sq_n = n[0]*n[0] + n[1]*n[1] + n[2]*n[2];
+
+    std::vector<std::pair<double, std::size_t> > positions(nb_planes);
+    for (std::size_t i=0; i<nb_planes; ++i)
     {
-      vdp.second=add_vertex(al_graph);
-      al_graph[vdp.second]=vdp.first;
+      CGAL_precondition(!plane_vector[i].is_degenerate());
+      const Plane_3& plane = plane_vector[i];
+      const double dot = n[0] * to_double(compute_a(plane)) +
+                         n[1] * to_double(compute_b(plane)) +
+                         n[2] * to_double(compute_c(plane));
+      positions[i] = std::make_pair(- to_double(compute_d(plane)) * sq_n / dot, i);
     }
+    std::sort(positions.begin(), positions.end());
 
-    Compare_face less_face(m_tmesh);
-    AL_edge_map al_edge_map( less_face );
+    std::vector<double> sorted_positions(nb_planes);
+    for (std::size_t i=0; i<nb_planes; ++i)
+      sorted_positions[i] = positions[i].first;
 
-    // Filter coplanar edges: we consider only coplanar edges incident to one non-coplanar facet
-    //   for each such edge, add the corresponding nodes in the adjacency-list graph as well as
-    //   the edge
-    for(const edge_descriptor ed : all_coplanar_edges)
-    {
-      if (  face(halfedge(ed, m_tmesh), m_tmesh)==graph_traits::null_face() ||
-            opposite_face(ed)==graph_traits::null_face()  ||
-            !all_coplanar_edges.count( next_edge(ed) ) ||
-            !all_coplanar_edges.count( next_of_opposite_edge(ed) ) )
-      {
-        typename Vertices_map::iterator it_insert1, it_insert2;
-        bool is_new;
+    // the projection of the edges on the normal, computed with doubles: the range of
+    // planes of an edge is enlarged to account for the rounding errors, as the edges
+    // are classified with the exact predicates afterwards
+    const std::vector<edge_descriptor> all_edges(edges(m_tmesh).first, edges(m_tmesh).second);
+    const std::size_t nb_edges = all_edges.size();
 
-        // Each coplanar edge is connecting two nodes
-        //  handle source
-        std::tie(it_insert1, is_new) =
-          vertices.insert(
-              Vertex_pair(
-                source(ed,m_tmesh), AL_graph::null_vertex()
-              )
-          );
-        if (is_new)
-        {
-          it_insert1->second=add_vertex(al_graph);
-          al_graph[it_insert1->second]=it_insert1->first;
-        }
-        //  handle target
-        std::tie(it_insert2, is_new) =
-          vertices.insert(
-              Vertex_pair(
-                target(ed,m_tmesh), AL_graph::null_vertex()
-              )
-          );
-        if (is_new)
-        {
-          it_insert2->second=add_vertex(al_graph);
-          al_graph[it_insert2->second]=it_insert2->first;
-        }
-        // add the edge into the adjacency-list graph
-        CGAL_assertion( it_insert1->second!=AL_graph::null_vertex() );
-        CGAL_assertion( it_insert2->second!=AL_graph::null_vertex() );
-        add_edge(it_insert1->second, it_insert2->second, al_graph);
-      }
-    }
-
-    // for each edge intersected in its interior, creates a node in
-    // an adjacency-list graph and put an edge between two such nodes
-    // when the corresponding edges shares a common face
-    for(edge_descriptor ed : iedges)
+    auto project = [&](vertex_descriptor v)
     {
-      AL_vertex_descriptor vd=add_vertex(al_graph);
-      al_graph[vd]=ed;
-      update_al_graph_connectivity(ed, vd, al_edge_map, al_graph);
-    }
-
-    // If one of the node above is not connected in its two incident faces
-    // then it must be connected to a vertex (including those in the set
-    // of coplanar edges)
-    typedef std::pair<halfedge_descriptor, AL_vertex_pair> Halfedge_and_vertices;
-    for(Halfedge_and_vertices hnv :al_edge_map)
+      const Point_3& p = get(m_vpmap, v);
+      return n[0] * to_double(p.x()) + n[1] * to_double(p.y()) + n[2] * to_double(p.z());
+    };
+
+    double max_abs_value = 0;
+    for (const std::pair<double, std::size_t>& pos : positions)
+      max_abs_value = (std::max)(max_abs_value, CGAL::abs(pos.first));
+    for (vertex_descriptor v : vertices(m_tmesh))
     {
-      if (hnv.second.second==AL_graph::null_vertex())
-      {
-        //get the edge and test opposite vertices (if the edge is not on the boundary)
-        vertex_descriptor vd = target( next(hnv.first, m_tmesh), m_tmesh);
-        typename Vertices_map::iterator itv=vertices.find(vd);
-        CGAL_assertion( itv!=vertices.end() );
-        add_edge(itv->second, hnv.second.first, al_graph);
-      }
+      const Point_3& p = get(m_vpmap, v);
+      max_abs_value = (std::max)(max_abs_value, CGAL::abs(n[0] * to_double(p.x())) +
+                                                CGAL::abs(n[1] * to_double(p.y())) +
+                                                CGAL::abs(n[2] * to_double(p.z())));
     }
+    const double tolerance = max_abs_value * 1e-10;
 
-    CGAL_assertion(num_vertices(al_graph)==iedges.size()+vertices.size());
-
-    // now assemble the edges of al_graph to define polylines,
-    // putting them in the output iterator
-    if (!UseParallelPlaneOptimization || app_info.first==-1)
+    std::vector<std::pair<std::size_t, std::size_t> > plane_ranges(nb_edges);
+    auto compute_plane_range = [&](std::size_t i)
     {
-      Polyline_visitor<OutputIterator, Traits> visitor(m_tmesh, al_graph, plane, m_vpmap, m_traits, out);
-      split_graph_into_polylines(al_graph, visitor);
-      return visitor.out;
-    }
+      double ps = project(source(all_edges[i], m_tmesh));
+      double pt = project(target(all_edges[i], m_tmesh));
+      if (pt < ps)
+        std::swap(ps, pt);
+      plane_ranges[i] = std::make_pair(
+        std::lower_bound(sorted_positions.begin(), sorted_positions.end(), ps - tolerance) - sorted_positions.begin(),
+        std::upper_bound(sorted_positions.begin(), sorted_positions.end(), pt + tolerance) - sorted_positions.begin());
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      tbb::parallel_for(std::size_t(0), nb_edges, compute_plane_range);
     else
+#endif
+      for (std::size_t i=0; i<nb_edges; ++i)
+        compute_plane_range(i);
+
+    // the candidate edges of each plane, in the order of `positions`
+    std::vector<std::vector<edge_descriptor> > plane_edges(nb_planes);
+    for (std::size_t i=0; i<nb_edges; ++i)
+      for (std::size_t k=plane_ranges[i].first; k<plane_ranges[i].second; ++k)
+        plane_edges[k].push_back(all_edges[i]);
+    std::vector<std::pair<std::size_t, std::size_t> >().swap(plane_ranges);
+
+    std::vector<std::vector<Polyline> > polylines(nb_planes);
+    auto slice = [&](std::size_t k)
     {
-      typedef Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits> App_traits;
-      App_traits app_traits(app_info.first, app_info.second, m_traits);
+      const Plane_3& plane = plane_vector[positions[k].second];
 
-      Polyline_visitor<OutputIterator, App_traits> visitor
-        (m_tmesh, al_graph, plane, m_vpmap, app_traits, out);
-      split_graph_into_polylines(al_graph, visitor);
-      return visitor.out;
-    }
+      std::set<edge_descriptor> all_coplanar_edges;
+      std::vector<edge_descriptor> iedges;
+      Vertices_map vertices;
+
+      std::pair<int, FT> app_info = axis_parallel_plane_info(plane);
+      if (!UseParallelPlaneOptimization || app_info.first==-1)
+        classify_edges(plane, m_traits, plane_edges[k], all_coplanar_edges, iedges, vertices);
+      else
+        classify_edges(plane, Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits>(app_info.first, app_info.second, m_traits),
+                       plane_edges[k], all_coplanar_edges, iedges, vertices);
+      std::vector<edge_descriptor>().swap(plane_edges[k]);
+
+      build_polylines(plane, app_info, all_coplanar_edges, iedges, vertices,
+                      std::back_inserter(polylines[positions[k].second]));
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      tbb::parallel_for(std::size_t(0), nb_planes, slice);
+    else
+#endif
+      for (std::size_t k=0; k<nb_planes; ++k)
+        slice(k);
+
+    for (std::vector<Polyline>& plane_polylines : polylines)
+      *out++ = std::move(plane_polylines);
+    return out;
   }
 
   ~Polygon_mesh_slicer()
@@ -70,6 +70,7 @@
 
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 
 #ifdef CGAL_ENVELOPE_DEBUG
 // This is for computing the surface mesh of a prism
@@ -83,11 +84,18 @@
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/range/has_range_iterator.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <atomic>
 #include <string>
 #include <fstream>
 #include <type_traits>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 
@@ -356,6 +364,11 @@ public:
    *                    as key type and `double` as value type}
    *     \cgalParamDefault{Use `epsilon` for all faces}
    *   \cgalParamNEnd
+   *   \cgalParamNBegin{concurrency_tag}
+   *     \cgalParamDescription{a tag indicating if the prisms should be built using one or several threads.}
+   *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+   *     \cgalParamDefault{`CGAL::Sequential_tag`}
+   *   \cgalParamNEnd
    * \cgalNamedParamsEnd
    *
    * \note The triangle mesh gets copied internally, that is it can be modified after having passed as argument,
@@ -370,6 +383,10 @@ public:
     using parameters::get_parameter;
     using parameters::is_default_parameter;
 
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+
     typedef boost::graph_traits<TriangleMesh> Graph_traits;
     typedef typename Graph_traits::face_descriptor face_descriptor;
 
@@ -405,7 +422,7 @@ public:
         deg_faces.insert(f);
     }
     if (is_default_parameter<NamedParameters, internal_np::face_epsilon_map_t>::value)
-      init(epsilon);
+      init<Concurrency_tag>(epsilon);
     else
     {
       std::vector<double> epsilon_values;
@@ -423,7 +440,7 @@ public:
       for(face_descriptor f : faces(tmesh))
         if(deg_faces.count(f)==0)
           epsilon_values.push_back( get(epsilon_map, f) );
-      init(epsilon_values);
+      init<Concurrency_tag>(epsilon_values);
     }
   }
 
@@ -456,6 +473,11 @@ public:
    *                    as key type and `double` as value type}
    *     \cgalParamDefault{Use `epsilon` for all faces}
    *   \cgalParamNEnd
+   *   \cgalParamNBegin{concurrency_tag}
+   *     \cgalParamDescription{a tag indicating if the prisms should be built using one or several threads.}
+   *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+   *     \cgalParamDefault{`CGAL::Sequential_tag`}
+   *   \cgalParamNEnd
    * \cgalNamedParamsEnd
    *
    * \note The triangle mesh gets copied internally, that is it can be modified after having passed as argument,
@@ -475,6 +497,10 @@ public:
     using parameters::get_parameter;
     using parameters::is_default_parameter;
 
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+
     typename GetVertexPointMap<TriangleMesh, NamedParameters>::const_type
       vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
                              get_const_property_map(CGAL::vertex_point, tmesh));
@@ -514,7 +540,7 @@ public:
     }
 
     if (is_default_parameter<NamedParameters, internal_np::face_epsilon_map_t>::value)
-      init(epsilon);
+      init<Concurrency_tag>(epsilon);
     else
     {
       std::vector<double> epsilon_values;
@@ -532,7 +558,7 @@ public:
       for(face_descriptor f : face_range)
         if(deg_faces.count(f)==0)
           epsilon_values.push_back( get(epsilon_map, f) );
-      init(epsilon_values);
+      init<Concurrency_tag>(epsilon_values);
     }
   }
 
@@ -563,6 +589,11 @@ public:
     *     \cgalParamType{a class model of `ReadablePropertyMap` with `std::size_t` as key type and `double` as value type}
     *     \cgalParamDefault{Use `epsilon` for all triangles}
     *   \cgalParamNEnd
+    *   \cgalParamNBegin{concurrency_tag}
+    *     \cgalParamDescription{a tag indicating if the prisms should be built using one or several threads.}
+    *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+    *     \cgalParamDefault{`CGAL::Sequential_tag`}
+    *   \cgalParamNEnd
     * \cgalNamedParamsEnd
     *
     */
@@ -580,6 +611,10 @@ public:
     using parameters::get_parameter;
     using parameters::is_default_parameter;
 
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+
     typedef typename CGAL::GetPointMap<PointRange, NamedParameters>::const_type Point_map;
     Point_map pm = choose_parameter<Point_map>(get_parameter(np, internal_np::point_map));
 
@@ -599,7 +634,7 @@ public:
 
     if (is_default_parameter<NamedParameters, internal_np::face_epsilon_map_t>::value)
     {
-      init(epsilon);
+      init<Concurrency_tag>(epsilon);
     }
     else
     {
@@ -617,7 +652,7 @@ public:
 
       for(std::size_t i=0; i<triangles.size(); ++i)
         epsilon_values.push_back( get(epsilon_map, i) );
-      init(epsilon_values);
+      init<Concurrency_tag>(epsilon_values);
     }
   }
 
@@ -625,10 +660,10 @@ public:
 
 private:
 
-  template <class Epsilons>
+  template <class ConcurrencyTag, class Epsilons>
   void init(const Epsilons& epsilon_values)
   {
-    halfspace_generation(env_vertices, env_faces, halfspace, bounding_boxes, epsilon_values);
+    halfspace_generation<ConcurrencyTag>(env_vertices, env_faces, halfspace, bounding_boxes, epsilon_values);
 
     Datum_map<GeomTraits> datum_map(bounding_boxes);
     Point_map<GeomTraits> point_map(bounding_boxes);
@@ -1909,26 +1944,56 @@ private:
     return Plane(plane0, plane1,plane2);
   }
 
-  double get_epsilon(double epsilon, std::size_t)
+  double get_epsilon(double epsilon, std::size_t) const
   {
     return epsilon;
   }
 
-  double get_epsilon(const std::vector<double>& epsilon_values, std::size_t i)
+  double get_epsilon(const std::vector<double>& epsilon_values, std::size_t i) const
   {
     return epsilon_values[i];
   }
 
   // build prisms for a list of triangles. each prism is represented by 7-8 planes, which are represented by 3 points
-  template <class Epsilons>
+  // The prisms are independent, so they can be built in parallel.
+  template <class ConcurrencyTag, class Epsilons>
   void
   halfspace_generation(const std::vector<Point_3> &ver, const std::vector<Vector3i> &faces,
                        std::vector<Prism>& halfspace,
-                       std::vector<Iso_cuboid_3>& bounding_boxes, const Epsilons& epsilon_values)
+                       std::vector<Iso_cuboid_3>& bounding_boxes, const Epsilons& epsilon_values) const
+  {
+    halfspace.resize(faces.size());
+    bounding_boxes.resize(faces.size());
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, faces.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            prism_generation(i, ver, faces, halfspace[i], bounding_boxes[i], epsilon_values);
+                        });
+    else
+#endif
+      for (std::size_t i = 0; i < faces.size(); ++i)
+        prism_generation(i, ver, faces, halfspace[i], bounding_boxes[i], epsilon_values);
+  }
+
+  // build the prism of the triangle `faces[i]`
+  template <class Epsilons>
+  void
+  prism_generation(const std::size_t i,
+                   const std::vector<Point_3> &ver, const std::vector<Vector3i> &faces,
+                   Prism& prism, Iso_cuboid_3& bounding_box, const Epsilons& epsilon_values) const
   {
     Vector_3 AB, AC, BC, normal;
     Plane plane;
+#if 0
     std::array<Vector_3, 8> box;
+#endif
 
 #if 0
     static const std::array<Vector_3, 8> boxorder = {
@@ -1947,160 +2012,154 @@ private:
 #endif
     bool use_accurate_cross = false;
 
-    halfspace.resize(faces.size());
-    bounding_boxes.resize(faces.size());
-    for (unsigned int i = 0; i < faces.size(); ++i)
-      {
-        const double epsilon = get_epsilon(epsilon_values,i);
-        double tolerance = epsilon / std::sqrt(3);// the envelope thickness, to be conservative
-        double bbox_tolerance = epsilon *(1 + 1e-6);
+    const double epsilon = get_epsilon(epsilon_values,i);
+    double tolerance = epsilon / std::sqrt(3);// the envelope thickness, to be conservative
+    double bbox_tolerance = epsilon *(1 + 1e-6);
 
-        Bbox bb = ver[faces[i][0]].bbox () + ver[faces[i][1]].bbox() + ver[faces[i][2]].bbox();
-        // todo: Add a grow() function to Bbox
-        bounding_boxes[i] = Iso_cuboid_3(Point_3(bb.xmin()-bbox_tolerance, bb.ymin()-bbox_tolerance, bb.zmin()-bbox_tolerance),
-                                         Point_3(bb.xmax()+bbox_tolerance, bb.ymax()+bbox_tolerance, bb.zmax()+bbox_tolerance));
+    Bbox bb = ver[faces[i][0]].bbox () + ver[faces[i][1]].bbox() + ver[faces[i][2]].bbox();
+    // todo: Add a grow() function to Bbox
+    bounding_box = Iso_cuboid_3(Point_3(bb.xmin()-bbox_tolerance, bb.ymin()-bbox_tolerance, bb.zmin()-bbox_tolerance),
+                                Point_3(bb.xmax()+bbox_tolerance, bb.ymax()+bbox_tolerance, bb.zmax()+bbox_tolerance));
 
-        AB = ver[faces[i][1]] - ver[faces[i][0]];
-        AC = ver[faces[i][2]] - ver[faces[i][0]];
-        BC = ver[faces[i][2]] - ver[faces[i][1]];
+    AB = ver[faces[i][1]] - ver[faces[i][0]];
+    AC = ver[faces[i][2]] - ver[faces[i][0]];
+    BC = ver[faces[i][2]] - ver[faces[i][1]];
 
 #if 0
-        int de = algorithms::is_triangle_degenerated(ver[faces[i][0]], ver[faces[i][1]], ver[faces[i][2]]);
+    int de = algorithms::is_triangle_degenerated(ver[faces[i][0]], ver[faces[i][1]], ver[faces[i][2]]);
 
-        if (de == DEGENERATED_POINT)
+    if (de == DEGENERATED_POINT)
+      {
+        for (int j = 0; j < 8; j++)
           {
-            for (int j = 0; j < 8; j++)
-              {
-                box[j] = ver[faces[i][0]] + boxorder[j] * tolerance;
-              }
-            halfspace[i].resize(6);
-            for (int j = 0; j < 6; j++) {
-              halfspace[i][j][0] = box[c_face[j][0]];
-              halfspace[i][j][1] = box[c_face[j][1]];
-              halfspace[i][j][2] = box[c_face[j][2]];
-            }
-
-
-            continue;
+            box[j] = ver[faces[i][0]] + boxorder[j] * tolerance;
           }
-        if (de == DEGENERATED_SEGMENT)
-          {
-            //logger().debug("Envelope Triangle Degeneration- Segment");
-            Scalar length1 = AB.dot(AB), length2 = AC.dot(AC), length3 = BC.dot(BC);
-            if (length1 >= length2 && length1 >= length3)
-              {
-                algorithms::seg_cube(ver[faces[i][0]], ver[faces[i][1]], tolerance, box);
-
-              }
-            if (length2 >= length1 && length2 >= length3)
-              {
-                algorithms::seg_cube(ver[faces[i][0]], ver[faces[i][2]], tolerance, box);
+        prism.resize(6);
+        for (int j = 0; j < 6; j++) {
+          prism[j][0] = box[c_face[j][0]];
+          prism[j][1] = box[c_face[j][1]];
+          prism[j][2] = box[c_face[j][2]];
+        }
 
-              }
-            if (length3 >= length1 && length3 >= length2)
-              {
-                algorithms::seg_cube(ver[faces[i][1]], ver[faces[i][2]], tolerance, box);
-              }
-            halfspace[i].resize(6);
-            for (int j = 0; j < 6; j++) {
-              halfspace[i][j][0] = box[c_face[j][0]];
-              halfspace[i][j][1] = box[c_face[j][1]];
-              halfspace[i][j][2] = box[c_face[j][2]];
-            }
 
+        return;
+      }
+    if (de == DEGENERATED_SEGMENT)
+      {
+        //logger().debug("Envelope Triangle Degeneration- Segment");
+        Scalar length1 = AB.dot(AB), length2 = AC.dot(AC), length3 = BC.dot(BC);
+        if (length1 >= length2 && length1 >= length3)
+          {
+            algorithms::seg_cube(ver[faces[i][0]], ver[faces[i][1]], tolerance, box);
 
-            continue;
           }
-        if (de == NERLY_DEGENERATED)
+        if (length2 >= length1 && length2 >= length3)
           {
-            //logger().debug("Envelope Triangle Degeneration- Nearly");
-            use_accurate_cross = true;
-
-            normal = algorithms::accurate_normal_vector(ver[faces[i][0]], ver[faces[i][1]], ver[faces[i][2]]);
+            algorithms::seg_cube(ver[faces[i][0]], ver[faces[i][2]], tolerance, box);
 
           }
-        else
+        if (length3 >= length1 && length3 >= length2)
           {
-            normal = normalize(cross_product(AB, AC));
+            algorithms::seg_cube(ver[faces[i][1]], ver[faces[i][2]], tolerance, box);
           }
-#endif
-        normal = normalize(cross_product(AB, AC)); // remove as soon as #if 1 above
-
-        halfspace[i].reserve(8);
-        Vector_3 normaldist = normal * tolerance;
-        Vector_3 edgedire, edgenormaldist;
-        plane = Plane(ver[faces[i][0]] + normaldist,
-                      ver[faces[i][1]] + normaldist,
-                      ver[faces[i][2]] + normaldist);
-        halfspace[i].emplace_back(plane);// number 0
-
-        plane = Plane(ver[faces[i][0]] - normaldist,
-                      ver[faces[i][2]] - normaldist,
-                      ver[faces[i][1]] - normaldist);// order: 0, 2, 1
-        halfspace[i].emplace_back(plane);// number 1
-
-        int obtuse = obtuse_angle(ver[faces[i][0]], ver[faces[i][1]], ver[faces[i][2]]);
-        halfspace[i].obtuse = obtuse;
-
-        edgedire = normalize(AB);
-        // if (use_accurate_cross)edgenormaldist = accurate_cross_product_direction(ORIGIN, edgedire, ORIGIN, normal)*tolerance;
-        // else
-        edgenormaldist = normalize(cross_product(edgedire,normal))*tolerance;
-        plane = Plane(ver[faces[i][0]] + edgenormaldist,
-                      ver[faces[i][1]] + edgenormaldist,
-                      ver[faces[i][0]] + edgenormaldist + normal);
-        halfspace[i].emplace_back(plane);// number 2
-
-        if (obtuse != 1) {
-          plane = get_corner_plane(ver[faces[i][1]], midpoint(ver[faces[i][0]], ver[faces[i][2]]) , normal,
-                                   tolerance, use_accurate_cross);
-          halfspace[i].emplace_back(plane);// number 3;
+        prism.resize(6);
+        for (int j = 0; j < 6; j++) {
+          prism[j][0] = box[c_face[j][0]];
+          prism[j][1] = box[c_face[j][1]];
+          prism[j][2] = box[c_face[j][2]];
         }
 
-        edgedire = normalize(BC);
-        // if (use_accurate_cross)edgenormaldist = accurate_cross_product_direction(ORIGIN, edgedire, ORIGIN, normal)*tolerance;
-        // else
-        edgenormaldist = normalize(cross_product(edgedire, normal))*tolerance;
 
-        plane = Plane(ver[faces[i][1]] + edgenormaldist,
-                      ver[faces[i][2]] + edgenormaldist,
-                      ver[faces[i][1]] + edgenormaldist + normal);
-        halfspace[i].emplace_back(plane);// number 4
-
-        if (obtuse != 2) {
-          plane = get_corner_plane(ver[faces[i][2]], midpoint(ver[faces[i][0]], ver[faces[i][1]]), normal,
-                                   tolerance,use_accurate_cross);
-          halfspace[i].emplace_back(plane);// number 5;
-        }
-
-        edgedire = -normalize(AC);
-        // if (use_accurate_cross)edgenormaldist = accurate_cross_product_direction(ORIGIN, edgedire, ORIGIN , normal)*tolerance;
-        // else
-        edgenormaldist = normalize(cross_product(edgedire, normal))*tolerance;
+        return;
+      }
+    if (de == NERLY_DEGENERATED)
+      {
+        //logger().debug("Envelope Triangle Degeneration- Nearly");
+        use_accurate_cross = true;
 
-        plane = Plane(ver[faces[i][2]] + edgenormaldist,
-                      ver[faces[i][0]] + edgenormaldist,
-                      ver[faces[i][0]] + edgenormaldist + normal);
-        halfspace[i].emplace_back(plane);// number 6
+        normal = algorithms::accurate_normal_vector(ver[faces[i][0]], ver[faces[i][1]], ver[faces[i][2]]);
 
-        if (obtuse != 0) {
-          plane = get_corner_plane(ver[faces[i][0]], midpoint(ver[faces[i][1]], ver[faces[i][2]]) , normal,
-                                   tolerance,use_accurate_cross);
-          halfspace[i].emplace_back(plane);// number 7;
-        }
+      }
+    else
+      {
+        normal = normalize(cross_product(AB, AC));
+      }
+#endif
+    normal = normalize(cross_product(AB, AC)); // remove as soon as #if 1 above
+
+    prism.reserve(8);
+    Vector_3 normaldist = normal * tolerance;
+    Vector_3 edgedire, edgenormaldist;
+    plane = Plane(ver[faces[i][0]] + normaldist,
+                  ver[faces[i][1]] + normaldist,
+                  ver[faces[i][2]] + normaldist);
+    prism.emplace_back(plane);// number 0
+
+    plane = Plane(ver[faces[i][0]] - normaldist,
+                  ver[faces[i][2]] - normaldist,
+                  ver[faces[i][1]] - normaldist);// order: 0, 2, 1
+    prism.emplace_back(plane);// number 1
+
+    int obtuse = obtuse_angle(ver[faces[i][0]], ver[faces[i][1]], ver[faces[i][2]]);
+    prism.obtuse = obtuse;
+
+    edgedire = normalize(AB);
+    // if (use_accurate_cross)edgenormaldist = accurate_cross_product_direction(ORIGIN, edgedire, ORIGIN, normal)*tolerance;
+    // else
+    edgenormaldist = normalize(cross_product(edgedire,normal))*tolerance;
+    plane = Plane(ver[faces[i][0]] + edgenormaldist,
+                  ver[faces[i][1]] + edgenormaldist,
+                  ver[faces[i][0]] + edgenormaldist + normal);
+    prism.emplace_back(plane);// number 2
+
+    if (obtuse != 1) {
+      plane = get_corner_plane(ver[faces[i][1]], midpoint(ver[faces[i][0]], ver[faces[i][2]]) , normal,
+                               tolerance, use_accurate_cross);
+      prism.emplace_back(plane);// number 3;
+    }
+
+    edgedire = normalize(BC);
+    // if (use_accurate_cross)edgenormaldist = accurate_cross_product_direction(ORIGIN, edgedire, ORIGIN, normal)*tolerance;
+    // else
+    edgenormaldist = normalize(cross_product(edgedire, normal))*tolerance;
+
+    plane = Plane(ver[faces[i][1]] + edgenormaldist,
+                  ver[faces[i][2]] + edgenormaldist,
+                  ver[faces[i][1]] + edgenormaldist + normal);
+    prism.emplace_back(plane);// number 4
+
+    if (obtuse != 2) {
+      plane = get_corner_plane(ver[faces[i][2]], midpoint(ver[faces[i][0]], ver[faces[i][1]]), normal,
+                               tolerance,use_accurate_cross);
+      prism.emplace_back(plane);// number 5;
+    }
+
+    edgedire = -normalize(AC);
+    // if (use_accurate_cross)edgenormaldist = accurate_cross_product_direction(ORIGIN, edgedire, ORIGIN , normal)*tolerance;
+    // else
+    edgenormaldist = normalize(cross_product(edgedire, normal))*tolerance;
+
+    plane = Plane(ver[faces[i][2]] + edgenormaldist,
+                  ver[faces[i][0]] + edgenormaldist,
+                  ver[faces[i][0]] + edgenormaldist + normal);
+    prism.emplace_back(plane);// number 6
+
+    if (obtuse != 0) {
+      plane = get_corner_plane(ver[faces[i][0]], midpoint(ver[faces[i][1]], ver[faces[i][2]]) , normal,
+                               tolerance,use_accurate_cross);
+      prism.emplace_back(plane);// number 7;
+    }
 
 #ifdef CGAL_ENVELOPE_DEBUG
-        std::cout << "face "<< i << std::endl;
-        for(unsigned int j = 0; j < halfspace[i].size(); j++){
-          const Plane& p =  halfspace[i][j];
-          std::cout << p.ep << " | "  << p.eq << " | "  << p.er << std::endl;
-          ePoint_3 pv(ver[faces[i][0]].x(), ver[faces[i][0]].y(),ver[faces[i][0]].z());
-          Orientation ori = orientation(p.ep, p.eq, p.er, pv);
-          CGAL_assertion(ori == NEGATIVE);
-        }
+    std::cout << "face "<< i << std::endl;
+    for(unsigned int j = 0; j < prism.size(); j++){
+      const Plane& p =  prism[j];
+      std::cout << p.ep << " | "  << p.eq << " | "  << p.er << std::endl;
+      ePoint_3 pv(ver[faces[i][0]].x(), ver[faces[i][0]].y(),ver[faces[i][0]].z());
+      Orientation ori = orientation(p.ep, p.eq, p.er, pv);
+      CGAL_assertion(ori == NEGATIVE);
+    }
 #endif
-
-      }
   }
 
 #ifdef CGAL_ENVELOPE_DEBUG
@@ -2224,8 +2283,12 @@ public:
    *     \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
    *                     must be available in `TriangleMesh`.}
    *   \cgalParamNEnd
+   *   \cgalParamNBegin{concurrency_tag}
+   *     \cgalParamDescription{a tag indicating if the triangles should be tested using one or several threads.}
+   *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+   *     \cgalParamDefault{`CGAL::Sequential_tag`}
+   *   \cgalParamNEnd
    * \cgalNamedParamsEnd
-   * \todo Add ConcurrencyTag as template parameter + use TBB parallel for
    * \todo Find a way to test the containment of the vertices first and then
    *       the triangles. It requires to have a map vertex->prism id so that
    *       we can test if the 3 vertices of a face are in the same face + have
@@ -2244,23 +2307,25 @@ public:
     using parameters::choose_parameter;
     using parameters::get_parameter;
 
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
+
     typename GetVertexPointMap<TriangleMesh, CGAL_NP_CLASS>::const_type
       vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
                              get_const_property_map(CGAL::vertex_point, tmesh));
 
-    for (typename boost::graph_traits<TriangleMesh>::face_descriptor f : faces(tmesh))
+    typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+    std::vector<face_descriptor> face_list(faces(tmesh).begin(), faces(tmesh).end());
+
+    return all_inside<Concurrency_tag>(face_list.size(), [&](std::size_t i)
     {
       typename boost::graph_traits<TriangleMesh>::halfedge_descriptor h =
-        halfedge(f, tmesh);
-      if (! this->operator()(get(vpm, source(h, tmesh)),
-                             get(vpm, target(h, tmesh)),
-                             get(vpm, target(next(h, tmesh), tmesh))) )
-      {
-        return false;
-      }
-    }
-
-    return true;
+        halfedge(face_list[i], tmesh);
+      return this->operator()(get(vpm, source(h, tmesh)),
+                              get(vpm, target(h, tmesh)),
+                              get(vpm, target(next(h, tmesh), tmesh)));
+    });
   }
 
   /**
@@ -2284,6 +2349,11 @@ public:
     *                    is the value type of `PointRange::const_iterator`}
     *     \cgalParamDefault{`CGAL::Identity_property_map`}
     *   \cgalParamNEnd
+    *   \cgalParamNBegin{concurrency_tag}
+    *     \cgalParamDescription{a tag indicating if the triangles should be tested using one or several threads.}
+    *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+    *     \cgalParamDefault{`CGAL::Sequential_tag`}
+    *   \cgalParamNEnd
     * \cgalNamedParamsEnd
     *
     */
@@ -2297,23 +2367,27 @@ public:
 
     typedef typename std::iterator_traits<typename TriangleRange::const_iterator>::value_type Triangle;
 
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+
     typedef typename CGAL::GetPointMap<PointRange, NamedParameters>::const_type Point_map;
     Point_map pm = choose_parameter<Point_map>(get_parameter(np, internal_np::point_map));
 
-    std::array<Point_3, 3> pts;
+    std::vector<const Triangle*> triangle_list;
+    triangle_list.reserve(triangles.size());
     for (const Triangle& f : triangles)
+      triangle_list.push_back(&f);
+
+    return all_inside<Concurrency_tag>(triangle_list.size(), [&](std::size_t i)
     {
-      typename Triangle::const_iterator t_it = f.begin();
+      std::array<Point_3, 3> pts;
+      typename Triangle::const_iterator t_it = triangle_list[i]->begin();
       pts[0]=get(pm, points[*t_it]);
       pts[1]=get(pm, points[*(++t_it)]);
       pts[2]=get(pm, points[*(++t_it)]);
-      if (! this->operator()(pts[0], pts[1], pts[2]) )
-      {
-        return false;
-      }
-    }
-
-    return true;
+      return this->operator()(pts[0], pts[1], pts[2]);
+    });
   }
 
   /**
@@ -2349,6 +2423,60 @@ public:
     return true;
   }
 
+  /**
+   * tests whether each query of `queries` is inside the polyhedral envelope, and puts the
+   * results in `out`, in the order of `queries`.
+   * A query is either a point, or a triangle given by its three vertices.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel evaluation of the queries.
+   *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+   * @tparam QueryRange a model of `ConstRange` whose value type is either `Point_3`, or a model
+   *                    of `RandomAccessContainer` with `Point_3` as value type and three elements.
+   * @tparam OutputIterator an output iterator accepting `bool`
+   *
+   * @param queries a range of points or triangles
+   * @param out the output iterator
+   *
+   * @return `out` past the last output value
+   */
+  template <typename ConcurrencyTag = Sequential_tag, typename QueryRange, typename OutputIterator>
+  OutputIterator
+  is_inside(const QueryRange& queries, OutputIterator out) const
+  {
+    typedef typename boost::range_value<QueryRange>::type Query;
+
+    std::vector<const Query*> query_list;
+    for (const Query& q : queries)
+      query_list.push_back(&q);
+
+    // `std::vector<bool>` cannot be written concurrently
+    std::vector<char> inside(query_list.size());
+    auto test = [&](std::size_t i)
+    {
+      inside[i] = is_inside_query(*query_list[i]);
+    };
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, query_list.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            test(i);
+                        });
+    else
+#endif
+      for (std::size_t i = 0; i < query_list.size(); ++i)
+        test(i);
+
+    for (char b : inside)
+      *out++ = (b != 0);
+    return out;
+  }
+
   /// @}
 
   /// returns `true` if the polyhedral envelope is empty and `false` otherwise.
@@ -2357,6 +2485,55 @@ public:
     return env_faces.empty();
   }
 
+private:
+
+  bool is_inside_query(const Point_3& query) const
+  {
+    return (*this)(query);
+  }
+
+  template <typename Triangle>
+  bool is_inside_query(const Triangle& query) const
+  {
+    CGAL_assertion(query.size() == 3);
+    return (*this)(query[0], query[1], query[2]);
+  }
+
+  // returns `true` iff `is_inside(i)` is `true` for all `i` in `[0, n)`.
+  // In parallel, the ranges not yet started are skipped as soon as a test fails.
+  template <typename ConcurrencyTag, typename Test>
+  bool all_inside(std::size_t n, const Test& is_inside) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      std::atomic<bool> all_in(true);
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                          {
+                            if (!all_in.load(std::memory_order_relaxed))
+                              return;
+                            if (!is_inside(i))
+                            {
+                              all_in = false;
+                              return;
+                            }
+                          }
+                        });
+      return all_in;
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i)
+      if (!is_inside(i))
+        return false;
+    return true;
+  }
+
 }; // class Polyhedral_envelope
 
 } // namespace CGAL
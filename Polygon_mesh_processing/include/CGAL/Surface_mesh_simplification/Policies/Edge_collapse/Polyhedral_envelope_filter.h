@@ -17,6 +17,8 @@
 #include <CGAL/Default.h>
 #include <CGAL/intersections.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/tags.h>
 
 
 #include <CGAL/Polyhedral_envelope.h>
@@ -44,7 +46,9 @@ namespace internal {
 
 } // namespace internal
 
-template<typename GeomTraits,typename BaseFilter = internal::Dummy_filter2>
+template<typename GeomTraits,
+         typename BaseFilter = internal::Dummy_filter2,
+         typename ConcurrencyTag = Sequential_tag>
 class Polyhedral_envelope_filter
 {
   typedef GeomTraits                                                          Geom_traits;
@@ -87,7 +91,8 @@ private:
       m_faces.push_back(face);
     }
 
-    m_envelope = new Envelope(m_vertices, m_faces, m_dist);
+    m_envelope = new Envelope(m_vertices, m_faces, m_dist,
+                              parameters::concurrency_tag(ConcurrencyTag()));
   }
 
 
@@ -217,6 +217,45 @@ void test_CC_with_area_size_map(Mesh sm,
   }
 }
 
+void test_CC_parallel(Mesh sm,
+                      const Kernel& k)
+{
+  std::cout << " -- test in parallel -- " << std::endl;
+
+  typedef boost::graph_traits<Mesh>::face_descriptor                      face_descriptor;
+
+  const Kernel::FT bound = std::cos(0.7 * CGAL_PI);
+
+  Mesh::Property_map<face_descriptor,std::size_t> seq_map, par_map;
+  seq_map = sm.add_property_map<face_descriptor, std::size_t>("f:seq_CC").first;
+  par_map = sm.add_property_map<face_descriptor, std::size_t>("f:par_CC").first;
+
+  // the components must be numbered the same way
+  std::size_t seq_num = PMP::connected_components(sm, seq_map);
+  std::size_t par_num = PMP::connected_components(sm, par_map,
+                          CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(seq_num == par_num);
+  for(face_descriptor f : faces(sm))
+    assert(seq_map[f] == par_map[f]);
+
+  seq_num = PMP::connected_components(sm, seq_map,
+              CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(sm, k, bound)));
+  par_num = PMP::connected_components(sm, par_map,
+              CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(sm, k, bound))
+                               .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(seq_num == 3 && par_num == 3);
+  for(face_descriptor f : faces(sm))
+    assert(seq_map[f] == par_map[f]);
+
+  Mesh copy = sm;
+  PMP::keep_largest_connected_components(sm, 2,
+    CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(sm, k, bound)));
+  PMP::keep_largest_connected_components(copy, 2,
+    CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(copy, k, bound))
+                     .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(num_faces(sm) == num_faces(copy));
+}
+
 int main(int /*argc*/, char** /*argv*/)
 {
   const std::string filename = CGAL::data_file_path("meshes/blobby_3cc.off");
@@ -231,6 +270,7 @@ int main(int /*argc*/, char** /*argv*/)
 
   test_CC_with_default_size_map(sm, k);
   test_CC_with_area_size_map(sm, k);
+  test_CC_parallel(sm, k);
 
   return EXIT_SUCCESS;
 }
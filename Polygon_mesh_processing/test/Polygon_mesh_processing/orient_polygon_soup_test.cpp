@@ -81,6 +81,33 @@ bool test_orient(const bool save_oriented)
   return true;
 }
 
+// the parallel construction of the edge map must give the same orientation
+template <typename K>
+bool test_orient_parallel()
+{
+  std::cout << "test_orient_parallel() with K = " << typeid(K).name() << std::endl;
+
+  typedef typename K::Point_3 Point_3;
+
+  std::vector<Point_3> points;
+  std::vector<std::vector<std::size_t> > polygons;
+  if(!CGAL::IO::read_polygon_soup(CGAL::data_file_path("meshes/elephant.off"), points, polygons))
+  {
+    std::cerr << "Error " << __LINE__ << ": failed to read polygon soup.\n";
+    return false;
+  }
+
+  shuffle_soup(polygons);
+
+  std::vector<Point_3> seq_points = points, par_points = points;
+  std::vector<std::vector<std::size_t> > seq_polygons = polygons, par_polygons = polygons;
+  bool seq_oriented = PMP::orient_polygon_soup(seq_points, seq_polygons);
+  bool par_oriented = PMP::orient_polygon_soup(par_points, par_polygons,
+                                               CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+
+  return seq_oriented == par_oriented && seq_points == par_points && seq_polygons == par_polygons;
+}
+
 template <class K, class Tag>
 bool test_pipeline()
 {
@@ -194,6 +221,9 @@ int main()
   assert(res);
 
 #if defined(CGAL_LINKED_WITH_TBB)
+  res = test_orient_parallel<Epick>();
+  assert(res);
+
   res = test_pipeline<Epick, CGAL::Parallel_tag>();
   assert(res);
 
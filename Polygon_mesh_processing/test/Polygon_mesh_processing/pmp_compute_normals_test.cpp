@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel          EPICK;
 //typedef CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt  EPECK;
@@ -68,6 +69,28 @@ void test(const Mesh& mesh,
   PMP::compute_normals(mesh, vnormals, fnormals, CGAL::parameters::vertex_point_map(vpmap)
                                                                   .geom_traits(K()));
 
+  // the parallel version must give the same normals
+  std::vector<Vector> seq_vnormals, seq_fnormals;
+  for(vertex_descriptor v : vertices(mesh))
+    seq_vnormals.push_back(get(vnormals, v));
+  for(face_descriptor f : faces(mesh))
+    seq_fnormals.push_back(get(fnormals, f));
+
+  auto check_same_normals = [&]()
+  {
+    std::size_t i = 0;
+    for(vertex_descriptor v : vertices(mesh))
+      assert(get(vnormals, v) == seq_vnormals[i++]);
+    i = 0;
+    for(face_descriptor f : faces(mesh))
+      assert(get(fnormals, f) == seq_fnormals[i++]);
+  };
+
+  PMP::compute_normals(mesh, vnormals, fnormals, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  check_same_normals();
+  PMP::compute_vertex_normals(mesh, vnormals, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  check_same_normals();
+
 #if 1//def CGAL_PMP_COMPUTE_NORMAL_DEBUG_PP
   std::ofstream vn_out("vertex_normals.cgal.polylines.txt");
   std::ofstream fn_out("face_normals.cgal.polylines.txt");
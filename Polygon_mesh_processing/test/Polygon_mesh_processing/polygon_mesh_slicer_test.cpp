@@ -18,8 +18,11 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 
+#include <algorithm>
 #include <fstream>
 #include <cassert>
+#include <iterator>
+#include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epic;
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epec;
@@ -170,10 +173,84 @@ int test_slicer()
 }
 
 
+// slicing with a family of parallel planes must give the same polylines as slicing plane by plane
+template <typename K, typename ConcurrencyTag>
+void test_multiple_planes(const std::vector<typename K::Plane_3>& planes)
+{
+#ifdef USE_SURFACE_MESH
+  typedef CGAL::Surface_mesh<typename K::Point_3> Mesh;
+#else
+  typedef CGAL::Polyhedron_3<K> Mesh;
+#endif
+  typedef std::vector<typename K::Point_3> Polyline_type;
+  typedef std::vector< Polyline_type > Polylines;
+
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  Mesh m;
+  if (!input || !(input >> m)){
+    std::cerr << "Error: can not read file.\n";
+    assert(false);
+  }
+
+  CGAL::Polygon_mesh_slicer<Mesh, K> slicer(m);
+
+  std::vector<Polylines> all_polylines;
+  slicer.template operator()<ConcurrencyTag>(planes, std::back_inserter(all_polylines));
+  assert(all_polylines.size() == planes.size());
+
+  std::size_t nb_polylines = 0;
+  for (std::size_t i=0; i<planes.size(); ++i)
+  {
+    Polylines polylines;
+    slicer(planes[i], std::back_inserter(polylines));
+    assert(polylines.size() == all_polylines[i].size());
+    nb_polylines += polylines.size();
+
+    // the first point of a closed polyline depends on the order of the edges
+    auto add_points = [](const Polylines& polylines, std::vector<typename K::Point_3>& points)
+    {
+      for (const Polyline_type& polyline : polylines)
+      {
+        const bool closed = polyline.size() > 1 && polyline.front() == polyline.back();
+        points.insert(points.end(), polyline.begin(), closed ? polyline.end() - 1 : polyline.end());
+      }
+    };
+    std::vector<typename K::Point_3> points, batch_points;
+    add_points(polylines, points);
+    add_points(all_polylines[i], batch_points);
+    std::sort(points.begin(), points.end());
+    std::sort(batch_points.begin(), batch_points.end());
+    assert(points == batch_points);
+  }
+  assert(nb_polylines != 0);
+}
+
+template <typename K>
+void test_multiple_planes()
+{
+  typedef typename K::Plane_3 Plane_3;
+
+  // axis-parallel planes, in decreasing order, with a duplicate
+  std::vector<Plane_3> planes;
+  for (int i=20; i>=-20; --i)
+    planes.push_back(Plane_3(0, 0, 1, -0.02 * i));
+  planes.push_back(planes.front());
+  test_multiple_planes<K, CGAL::Sequential_tag>(planes);
+  test_multiple_planes<K, CGAL::Parallel_if_available_tag>(planes);
+
+  // oblique planes, with opposite orientations
+  planes.clear();
+  for (int i=-20; i<=20; ++i)
+    planes.push_back((i % 2 == 0) ? Plane_3(1, 2, 3, -0.05 * i) : Plane_3(-2, -4, -6, 0.1 * i));
+  test_multiple_planes<K, CGAL::Sequential_tag>(planes);
+  test_multiple_planes<K, CGAL::Parallel_if_available_tag>(planes);
+}
+
 int main()
 {
   assert(test_slicer<Epic>() == 0);
   assert(test_slicer<Epec>() == 0);
+  test_multiple_planes<Epic>();
 
   return 0;
 }
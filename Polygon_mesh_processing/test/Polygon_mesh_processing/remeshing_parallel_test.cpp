@@ -0,0 +1,81 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+#include <CGAL/Polygon_mesh_processing/tangential_relaxation.h>
+#include <CGAL/Polygon_mesh_processing/triangulate_faces.h>
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/Random.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Surface_mesh<K::Point_3>                      Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+namespace params = CGAL::parameters;
+
+// relaxation of a perturbed planar grid: no face must be inverted
+void test_relaxation()
+{
+  std::cout << "Relaxation of a grid" << std::endl;
+  Mesh sm;
+  CGAL::make_grid(50, 50, sm);
+  PMP::triangulate_faces(sm);
+
+  CGAL::Random rnd(0);
+  for(Mesh::Vertex_index v : vertices(sm))
+  {
+    const K::Point_3& p = sm.point(v);
+    sm.point(v) = K::Point_3(p.x() + rnd.get_double(-0.2, 0.2), p.y() + rnd.get_double(-0.2, 0.2), 0);
+  }
+
+  PMP::tangential_relaxation(sm, params::number_of_iterations(5)
+                                        .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  assert(sm.is_valid());
+  for(Mesh::Face_index f : faces(sm))
+    assert(PMP::compute_face_normal(f, sm).z() > 0);
+}
+
+void test_remeshing(const std::string& filename)
+{
+  std::cout << "Remeshing " << filename << std::endl;
+  Mesh input;
+  if(!PMP::IO::read_polygon_mesh(filename, input))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    std::exit(1);
+  }
+
+  const double target_edge_length = 0.02;
+  Mesh seq = input, par = input;
+  PMP::isotropic_remeshing(faces(seq), target_edge_length, seq,
+                           params::number_of_iterations(3));
+  PMP::isotropic_remeshing(faces(par), target_edge_length, par,
+                           params::number_of_iterations(3)
+                                  .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  assert(par.is_valid());
+  std::cout << "  " << num_faces(seq) << " faces (sequential), "
+            << num_faces(par) << " faces (parallel)" << std::endl;
+
+  // the relaxation does not move the vertices in the same order,
+  // but the output density must be similar
+  const double ratio = double(num_faces(par)) / double(num_faces(seq));
+  assert(ratio > 0.95 && ratio < 1.05);
+  CGAL_USE(ratio);
+}
+
+int main(int argc, char** argv)
+{
+  test_relaxation();
+  test_remeshing((argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off"));
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Surface_mesh<K::Point_3>                      Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+namespace params = CGAL::parameters;
+
+// the parallel version must produce the same triangles as the sequential one
+// (the order of the simplices depends on the memory layout in both cases)
+std::vector<std::array<K::Point_3, 3> > sorted_triangles(const Mesh& m)
+{
+  std::vector<std::array<K::Point_3, 3> > triangles;
+  for(Mesh::Face_index f : faces(m))
+  {
+    std::array<K::Point_3, 3> t;
+    int i = 0;
+    for(Mesh::Vertex_index v : vertices_around_face(m.halfedge(f), m))
+      t[i++] = m.point(v);
+    std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+    triangles.push_back(t);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+void check_same_mesh(const Mesh& m1, const Mesh& m2)
+{
+  assert(m1.is_valid() && m2.is_valid());
+  assert(num_vertices(m1) == num_vertices(m2));
+  assert(num_faces(m1) == num_faces(m2));
+  assert(sorted_triangles(m1) == sorted_triangles(m2));
+}
+
+template <class ConcurrencyTag>
+void run_union(Mesh tm1, Mesh tm2, Mesh& out)
+{
+  bool valid = PMP::corefine_and_compute_union(tm1, tm2, out,
+                                               params::concurrency_tag(ConcurrencyTag()));
+  assert(valid);
+  CGAL_USE(valid);
+}
+
+template <class ConcurrencyTag>
+void run_corefine(Mesh& tm1, Mesh& tm2)
+{
+  PMP::corefine(tm1, tm2, params::concurrency_tag(ConcurrencyTag()));
+}
+
+void test(const Mesh& tm1, const Mesh& tm2)
+{
+  std::cout << "  union\n";
+  Mesh seq_out, par_out;
+  run_union<CGAL::Sequential_tag>(tm1, tm2, seq_out);
+  run_union<CGAL::Parallel_if_available_tag>(tm1, tm2, par_out);
+  check_same_mesh(seq_out, par_out);
+
+  std::cout << "  corefine\n";
+  Mesh seq1 = tm1, seq2 = tm2, par1 = tm1, par2 = tm2;
+  run_corefine<CGAL::Sequential_tag>(seq1, seq2);
+  run_corefine<CGAL::Parallel_if_available_tag>(par1, par2);
+  check_same_mesh(seq1, par1);
+  check_same_mesh(seq2, par2);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/blobby.off");
+
+  Mesh tm1;
+  if(!PMP::IO::read_polygon_mesh(filename, tm1))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return 1;
+  }
+
+  std::cout << "Translated copy\n";
+  Mesh tm2 = tm1;
+  PMP::transform(K::Aff_transformation_3(CGAL::TRANSLATION, K::Vector_3(0.1, 0.05, 0.02)), tm2);
+  test(tm1, tm2);
+
+  // coplanar faces
+  std::cout << "Cubes\n";
+  Mesh c1, c2;
+  if(!PMP::IO::read_polygon_mesh(CGAL::data_file_path("meshes/cube.off"), c1))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return 1;
+  }
+  c2 = c1;
+  PMP::transform(K::Aff_transformation_3(CGAL::TRANSLATION, K::Vector_3(0.5, 0.25, 0.)), c2);
+  test(c1, c2);
+
+  std::cout << "Done\n";
+  return EXIT_SUCCESS;
+}
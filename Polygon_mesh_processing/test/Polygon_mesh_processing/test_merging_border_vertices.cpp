@@ -22,9 +22,21 @@ void test_merge_duplicated_vertices_in_boundary_cycles(const std::string fname,
 
   std::cout << "Testing merging in cycles " << fname << "\n";
   std::cout << "  input mesh has " << vertices(mesh).size() << " vertices.\n";
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Surface_mesh par_mesh = mesh;
+  CGAL::Polygon_mesh_processing::merge_duplicated_vertices_in_boundary_cycles(par_mesh,
+    CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+#endif
+
   CGAL::Polygon_mesh_processing::merge_duplicated_vertices_in_boundary_cycles(mesh);
   std::cout << "  output mesh has " << vertices(mesh).size() << " vertices.\n";
 
+#ifdef CGAL_LINKED_WITH_TBB
+  assert(is_valid_polygon_mesh(par_mesh));
+  assert(vertices(par_mesh).size() == vertices(mesh).size());
+#endif
+
   assert(expected_nb_vertices==0 ||
          expected_nb_vertices == vertices(mesh).size());
   if (expected_nb_vertices==0)
@@ -8,6 +8,8 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 
+#include <CGAL/Random.h>
+
 namespace PMP = CGAL::Polygon_mesh_processing;
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel EPIC;
@@ -129,9 +131,70 @@ void cube_test()
   assert(!envelope(P(0,0,0.2), P(1,0,0.2), P(1,1,0.2)));
 }
 
+// the parallel construction and the batch queries must give the same answers
+// as the sequential ones
+void test_parallel()
+{
+  std::cout << "---- test_parallel() ----\n";
+  typedef EPIC::Point_3 P;
+  typedef CGAL::Surface_mesh<P> Mesh;
+  Mesh sm;
+  std::ifstream in(CGAL::data_file_path("meshes/eight.off"));
+  in >> sm;
+  assert(sm.vertices().size()!=0);
+
+  const double epsilon = 0.001;
+  CGAL::Polyhedral_envelope<EPIC> seq_envelope(sm, epsilon);
+  CGAL::Polyhedral_envelope<EPIC> par_envelope(sm, epsilon,
+    CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(par_envelope(sm, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag())));
+
+  std::vector<Mesh::Face_index> subfaces(faces(sm).begin(), std::next(faces(sm).begin(), 150));
+  CGAL::Polyhedral_envelope<EPIC> sub_envelope(subfaces, sm, epsilon,
+    CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(!sub_envelope(sm, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag())));
+
+  // vertices randomly moved by up to twice the tolerance, and the triangles they form
+  CGAL::Random rnd(0);
+  std::vector<P> points;
+  for(Mesh::Vertex_index v : vertices(sm))
+  {
+    const P& p = sm.point(v);
+    points.emplace_back(p.x() + rnd.get_double(-2*epsilon, 2*epsilon),
+                        p.y() + rnd.get_double(-2*epsilon, 2*epsilon),
+                        p.z() + rnd.get_double(-2*epsilon, 2*epsilon));
+  }
+  std::vector<std::array<P, 3> > triangles;
+  for(Mesh::Face_index f : faces(sm))
+  {
+    Mesh::Halfedge_index h = sm.halfedge(f);
+    triangles.push_back( { points[sm.source(h)], points[sm.target(h)], points[sm.target(sm.next(h))] } );
+  }
+
+  std::vector<bool> seq_points, par_points, seq_triangles, par_triangles;
+  seq_envelope.is_inside(points, std::back_inserter(seq_points));
+  par_envelope.is_inside<CGAL::Parallel_if_available_tag>(points, std::back_inserter(par_points));
+  seq_envelope.is_inside(triangles, std::back_inserter(seq_triangles));
+  par_envelope.is_inside<CGAL::Parallel_if_available_tag>(triangles, std::back_inserter(par_triangles));
+
+  assert(seq_points.size() == points.size() && seq_triangles.size() == triangles.size());
+  assert(seq_points == par_points);
+  assert(seq_triangles == par_triangles);
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(seq_points[i] == seq_envelope(points[i]));
+  for(std::size_t i=0; i<triangles.size(); ++i)
+    assert(seq_triangles[i] == seq_envelope(triangles[i][0], triangles[i][1], triangles[i][2]));
+
+  // both answers must be represented
+  assert(std::count(seq_points.begin(), seq_points.end(), true) != 0);
+  assert(std::count(seq_points.begin(), seq_points.end(), false) != 0);
+  assert(std::count(seq_triangles.begin(), seq_triangles.end(), false) != 0);
+}
+
 int main()
 {
   test_remove_si();
   test_API();
   cube_test();
+  test_parallel();
 }
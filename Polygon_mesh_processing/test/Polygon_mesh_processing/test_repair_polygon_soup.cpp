@@ -5,6 +5,7 @@
 #include <CGAL/Surface_mesh.h>
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/IO/polygon_soup_io.h>
 
 #include <algorithm>
 #include <deque>
@@ -562,6 +563,81 @@ void test_slit_pinched_polygons(const bool /*verbose*/ = false)
   assert(polygons[3].size() == 2); // 1 3
 }
 
+// rotates and orients the polygons so that duplicates are equal, and sorts them
+std::vector<CGAL_polygon> sorted_canonical_polygons(const std::vector<CGAL_polygon>& polygons)
+{
+  std::vector<CGAL_polygon> canonical_polygons;
+  for(CGAL_polygon polygon : polygons)
+  {
+    std::rotate(polygon.begin(), std::min_element(polygon.begin(), polygon.end()), polygon.end());
+    CGAL_polygon reversed_polygon(polygon.rbegin(), polygon.rend());
+    std::rotate(reversed_polygon.begin(), reversed_polygon.end() - 1, reversed_polygon.end());
+    canonical_polygons.push_back((std::min)(polygon, reversed_polygon));
+  }
+  std::sort(canonical_polygons.begin(), canonical_polygons.end());
+  return canonical_polygons;
+}
+
+void test_parallel_repair()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "test parallel repair..." << std::endl;
+
+  std::vector<Point_3> points;
+  std::vector<CGAL_polygon> polygons;
+  if(!CGAL::IO::read_polygon_soup(CGAL::data_file_path("meshes/double-torus-example.off"), points, polygons))
+  {
+    std::cerr << "Error: failed to read polygon soup" << std::endl;
+    std::exit(1);
+  }
+
+  // duplicate all the points, and add polygons using the copies, some of them reversed
+  const std::size_t nb_points = points.size(), nb_polygons = polygons.size();
+  for(std::size_t i=0; i<nb_points; ++i)
+    points.push_back(points[i]);
+  for(std::size_t i=0; i<nb_polygons; i+=3)
+  {
+    CGAL_polygon polygon = polygons[i];
+    for(std::size_t& id : polygon)
+      id += nb_points;
+    if(i % 2 == 0)
+      std::reverse(polygon.begin(), polygon.end());
+    polygons.push_back(polygon);
+  }
+
+  std::vector<Point_3> seq_points = points, par_points = points;
+  std::vector<CGAL_polygon> seq_polygons = polygons, par_polygons = polygons;
+
+  std::size_t seq_res = PMP::merge_duplicate_points_in_polygon_soup(seq_points, seq_polygons);
+  std::size_t par_res = PMP::merge_duplicate_points_in_polygon_soup(par_points, par_polygons,
+                                                                    params::concurrency_tag(CGAL::Parallel_tag()));
+  assert(seq_res == nb_points && par_res == seq_res);
+  assert(seq_points == par_points && seq_polygons == par_polygons);
+
+  // the parallel version might not keep the same polygon among duplicates
+  seq_res = PMP::merge_duplicate_polygons_in_polygon_soup(seq_points, seq_polygons);
+  par_res = PMP::merge_duplicate_polygons_in_polygon_soup(par_points, par_polygons,
+                                                          params::concurrency_tag(CGAL::Parallel_tag()));
+  assert(par_res == seq_res && seq_polygons.size() == nb_polygons);
+  assert(sorted_canonical_polygons(seq_polygons) == sorted_canonical_polygons(par_polygons));
+
+  // same orientation required
+  seq_points = par_points = points;
+  seq_polygons = par_polygons = polygons;
+  PMP::repair_polygon_soup(seq_points, seq_polygons, params::require_same_orientation(true));
+  PMP::repair_polygon_soup(par_points, par_polygons, params::require_same_orientation(true)
+                                                            .concurrency_tag(CGAL::Parallel_tag()));
+  assert(seq_points == par_points);
+  assert(seq_polygons.size() == par_polygons.size() && seq_polygons.size() > nb_polygons);
+  std::sort(seq_polygons.begin(), seq_polygons.end());
+  std::sort(par_polygons.begin(), par_polygons.end());
+  assert(seq_polygons == par_polygons);
+
+  CGAL_USE(seq_res);
+  CGAL_USE(par_res);
+#endif
+}
+
 int main()
 {
   // test compilation with different polygon soup types
@@ -586,6 +662,7 @@ int main()
   test_remove_invalid_polygons(false);
   test_remove_isolated_points(false);
   test_slit_pinched_polygons(false);
+  test_parallel_repair();
 
   return EXIT_SUCCESS;
 }
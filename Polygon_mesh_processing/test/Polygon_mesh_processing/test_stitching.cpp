@@ -196,6 +196,80 @@ void test_local_stitch_borders()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+template <typename Mesh>
+void test_parallel_stitch_borders(const std::string fname,
+                                  const std::size_t expected_n,
+                                  const bool per_cc = false)
+{
+  std::cout << "Testing parallel stitch_borders(); file: " << fname << "..." << std::flush;
+
+  std::ifstream input(fname);
+  Mesh mesh;
+  if (!input || !(input >> mesh))
+  {
+    std::cerr << "Error: can not read file.";
+    return;
+  }
+
+  std::size_t res = PMP::stitch_borders(mesh, params::apply_per_connected_component(per_cc)
+                                                     .concurrency_tag(CGAL::Parallel_tag()));
+  std::cout << "res: " << res << " (expected: " << expected_n << ")" << std::endl;
+
+  assert(res == expected_n);
+  assert(is_valid_polygon_mesh(mesh));
+}
+
+// a grid made of independent tiles, that are all stitched together
+template <typename Mesh>
+void test_parallel_stitch_tiles()
+{
+  std::cout << "Testing parallel stitch_borders() on tiles" << std::endl;
+
+  typedef typename boost::property_traits<
+    typename CGAL::GetVertexPointMap<Mesh>::const_type>::value_type Point;
+
+  const int nb_tiles = 8, tile_size = 10;
+  Mesh tiles;
+  for(int tx=0; tx<nb_tiles; ++tx)
+    for(int ty=0; ty<nb_tiles; ++ty)
+      CGAL::make_grid(tile_size, tile_size, tiles,
+                      [&](int i, int j) { return Point(tx * tile_size + i, ty * tile_size + j, 0); },
+                      true /*triangulated*/);
+
+  Mesh seq = tiles, par = tiles;
+  std::size_t seq_res = PMP::stitch_borders(seq);
+  std::size_t par_res = PMP::stitch_borders(par, params::concurrency_tag(CGAL::Parallel_tag()));
+  assert(seq_res == std::size_t(2 * nb_tiles * (nb_tiles - 1) * tile_size));
+  assert(par_res == seq_res);
+  assert(is_valid_polygon_mesh(par));
+  assert(vertices(par).size() == vertices(seq).size());
+  assert(edges(par).size() == edges(seq).size());
+
+  // nothing to stitch within each tile
+  par = tiles;
+  par_res = PMP::stitch_borders(par, params::apply_per_connected_component(true)
+                                            .concurrency_tag(CGAL::Parallel_tag()));
+  assert(par_res == 0);
+
+  CGAL_USE(seq_res);
+  CGAL_USE(par_res);
+}
+
+template <typename Mesh>
+void test_parallel_stitch_borders()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  test_parallel_stitch_borders<Mesh>("data_stitching/full_border.off", 4);
+  test_parallel_stitch_borders<Mesh>("data_stitching/incidence_3.off", 3);
+  test_parallel_stitch_borders<Mesh>("data_stitching/non_manifold.off", 0);
+  test_parallel_stitch_borders<Mesh>("data_stitching/two_patches.off", 3);
+  test_parallel_stitch_borders<Mesh>("data_stitching/nm_cubes.off", 4, true /*per cc*/);
+  test_parallel_stitch_tiles<Mesh>();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <typename Mesh>
 void test_degenerate()
 {
@@ -222,6 +296,7 @@ void test()
 {
   test_stitch_boundary_cycles<Mesh>();
   test_stitch_borders<Mesh>();
+  test_parallel_stitch_borders<Mesh>();
   test_degenerate<Mesh>();
 }
 
@@ -16,6 +16,8 @@
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <vector>
 #include <set>
@@ -248,6 +250,101 @@ void test_triangulate_refine_and_fair_hole(const std::string file_name, bool use
   std::cout << "  Done!" << std::endl;
 }
 
+std::vector<std::array<Kernel::Point_3, 3> > sorted_triangles(const Polyhedron& poly)
+{
+  std::vector<std::array<Kernel::Point_3, 3> > triangles;
+  for(Facet_handle f : faces(poly))
+  {
+    std::array<Kernel::Point_3, 3> t;
+    int i = 0;
+    for(Vertex_handle v : vertices_around_face(halfedge(f, poly), poly))
+      t[i++] = get(CGAL::vertex_point, poly, v);
+    std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+    triangles.push_back(t);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+// the batch functions must not depend on the concurrency tag, and filling
+// all the holes at once must give the same patches as filling them one by one
+void test_triangulate_holes(const std::string file_name, bool use_cdt) {
+  std::cout << "test_triangulate_holes:" << std::endl;
+  std::cout << "  File: "<< file_name  << std::endl;
+  Polyhedron poly, poly_seq, poly_par;
+  std::vector<Halfedge_handle> border_reps, border_reps_seq, border_reps_par;
+  read_poly_with_borders(file_name, poly, border_reps);
+  read_poly_with_borders(file_name, poly_seq, border_reps_seq);
+  read_poly_with_borders(file_name, poly_par, border_reps_par);
+
+  for(Halfedge_handle h : border_reps)
+    CGAL::Polygon_mesh_processing::triangulate_hole(poly, h,
+      CGAL::parameters::use_2d_constrained_delaunay_triangulation(use_cdt));
+
+  const std::size_t nb_input_faces = num_faces(poly_seq);
+  std::vector<Facet_handle> patch_facets;
+  std::size_t nb_filled = CGAL::Polygon_mesh_processing::triangulate_holes(poly_seq, border_reps_seq,
+    CGAL::parameters::use_2d_constrained_delaunay_triangulation(use_cdt).
+      face_output_iterator(std::back_inserter(patch_facets)));
+  assert(nb_filled == border_reps.size());
+  assert(num_faces(poly_seq) == num_faces(poly));
+  assert(nb_input_faces + patch_facets.size() == num_faces(poly_seq));
+  CGAL_USE(nb_input_faces);
+
+  nb_filled = CGAL::Polygon_mesh_processing::triangulate_holes(poly_par, border_reps_par,
+    CGAL::parameters::use_2d_constrained_delaunay_triangulation(use_cdt).
+      concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(nb_filled == border_reps.size());
+  CGAL_USE(nb_filled);
+
+  assert(is_closed(poly_seq) && is_closed(poly_par));
+  assert(sorted_triangles(poly_seq) == sorted_triangles(poly));
+  assert(sorted_triangles(poly_par) == sorted_triangles(poly));
+
+  std::cout << "  Done!" << std::endl;
+}
+
+void test_triangulate_refine_and_fair_holes(const std::string file_name, bool use_cdt) {
+  std::cout << "test_triangulate_refine_and_fair_holes:" << std::endl;
+  std::cout << "  File: "<< file_name  << std::endl;
+  Polyhedron poly_seq, poly_par;
+  std::vector<Halfedge_handle> border_reps_seq, border_reps_par;
+  read_poly_with_borders(file_name, poly_seq, border_reps_seq);
+  read_poly_with_borders(file_name, poly_par, border_reps_par);
+
+  const std::size_t nb_input_vertices = num_vertices(poly_seq);
+  std::vector<Vertex_handle> patch_vertices;
+  std::pair<std::size_t, std::size_t> res_seq =
+    CGAL::Polygon_mesh_processing::triangulate_refine_and_fair_holes(poly_seq, border_reps_seq,
+      CGAL::parameters::use_2d_constrained_delaunay_triangulation(use_cdt).
+        vertex_output_iterator(std::back_inserter(patch_vertices)));
+  std::pair<std::size_t, std::size_t> res_par =
+    CGAL::Polygon_mesh_processing::triangulate_refine_and_fair_holes(poly_par, border_reps_par,
+      CGAL::parameters::use_2d_constrained_delaunay_triangulation(use_cdt).
+        concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  assert(res_seq.first == border_reps_seq.size());
+  assert(res_seq == res_par);
+  assert(num_vertices(poly_seq) == num_vertices(poly_par));
+  assert(nb_input_vertices + patch_vertices.size() == num_vertices(poly_seq));
+  assert(poly_seq.is_valid() && is_closed(poly_seq));
+
+  // the vertices are created in the same order, but the linear systems of the fairing
+  // might be ordered differently as vertex descriptors might be compared by address
+  auto vit_par = vertices(poly_par).begin();
+  for(Vertex_handle v : vertices(poly_seq))
+  {
+    assert(CGAL::squared_distance(get(CGAL::vertex_point, poly_seq, v),
+                                  get(CGAL::vertex_point, poly_par, *vit_par)) < 1e-12);
+    ++vit_par;
+  }
+  CGAL_USE(nb_input_vertices);
+  CGAL_USE(res_seq);
+  CGAL_USE(res_par);
+
+  std::cout << "  Done!" << std::endl;
+}
+
 void test_ouput_iterators_triangulate_hole(const std::string file_name, bool use_cdt) {
   std::cout << "test_ouput_iterators_triangulate_hole:" << std::endl;
   std::cout << "  File: "<< file_name  << std::endl;
@@ -413,6 +510,10 @@ int main()
     test_ouput_iterators_triangulate_hole(it->c_str(), false);
     test_triangulate_hole_weight(it->c_str(), true, 0);
     test_triangulate_hole_weight(it->c_str(), false, 0);
+    test_triangulate_holes(it->c_str(), true);
+    test_triangulate_holes(it->c_str(), false);
+    test_triangulate_refine_and_fair_holes(it->c_str(), true);
+    test_triangulate_refine_and_fair_holes(it->c_str(), false);
     std::cout << "------------------------------------------------" << std::endl;
   }
   test_triangulate_hole_should_be_no_output("data/non_manifold_vertex.off", true);
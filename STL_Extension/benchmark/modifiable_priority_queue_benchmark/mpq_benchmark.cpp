@@ -0,0 +1,134 @@
+// Compares the heap types of CGAL::Modifiable_priority_queue on two workloads:
+// - "collapse": a queue of n elements where each pop is followed by the update or removal
+//   of a few elements with close IDs, as in edge collapse simplification;
+// - "push/pop": elements are pushed with increasing priorities and popped in batches,
+//   as in the gate queue of Alpha_wrap_3.
+//
+// Usage: mpq_benchmark [number_of_elements]
+
+#include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Compare_cost
+{
+  Compare_cost(const std::vector<double>& costs) : costs(&costs) { }
+  bool operator()(std::size_t a, std::size_t b) const { return (*costs)[a] < (*costs)[b]; }
+
+  const std::vector<double>* costs;
+};
+
+template <CGAL::Heap_type heap_type>
+double collapse_workload(const std::size_t n, std::size_t& checksum)
+{
+  typedef CGAL::Modifiable_priority_queue<std::size_t, Compare_cost,
+                                          boost::typed_identity_property_map<std::size_t>,
+                                          heap_type> Queue;
+
+  CGAL::Random rnd(0);
+  std::vector<double> costs(n);
+  for(double& c : costs)
+    c = rnd.get_double();
+
+  CGAL::Real_timer timer;
+  timer.start();
+
+  Queue queue(n, Compare_cost(costs));
+  for(std::size_t i=0; i<n; ++i)
+    queue.push(i);
+
+  std::vector<bool> removed(n, false);
+  while(!queue.empty())
+  {
+    const std::size_t top = queue.top_and_pop();
+    removed[top] = true;
+    checksum += top;
+
+    // the neighbors of the collapsed edge get a higher cost, or disappear
+    for(int k=1; k<=6; ++k)
+    {
+      const std::size_t i = (top + k * 7) % n;
+      if(removed[i])
+        continue;
+
+      if(k <= 2)
+      {
+        queue.erase(i);
+        removed[i] = true;
+      }
+      else
+      {
+        costs[i] += 0.1 * rnd.get_double();
+        queue.update(i);
+      }
+    }
+  }
+
+  timer.stop();
+  return timer.time();
+}
+
+template <CGAL::Heap_type heap_type>
+double push_pop_workload(const std::size_t n, std::size_t& checksum)
+{
+  typedef CGAL::Modifiable_priority_queue<std::size_t, Compare_cost,
+                                          boost::typed_identity_property_map<std::size_t>,
+                                          heap_type> Queue;
+
+  CGAL::Random rnd(0);
+  std::vector<double> costs(n);
+
+  CGAL::Real_timer timer;
+  timer.start();
+
+  Queue queue(n, Compare_cost(costs));
+  std::size_t next = 0;
+  double time_stamp = 0;
+  while(next < n || !queue.empty())
+  {
+    // each popped element creates a few new ones, with larger priorities on average
+    for(int k=0; k<4 && next<n; ++k, ++next)
+    {
+      costs[next] = time_stamp + rnd.get_double();
+      queue.push(next);
+    }
+
+    for(int k=0; k<3 && !queue.empty(); ++k)
+    {
+      const std::size_t top = queue.top_and_pop();
+      time_stamp = costs[top];
+      checksum += top;
+    }
+  }
+
+  timer.stop();
+  return timer.time();
+}
+
+template <CGAL::Heap_type heap_type>
+void run(const std::string& name, const std::size_t n)
+{
+  std::size_t checksum = 0;
+  const double t1 = collapse_workload<heap_type>(n, checksum);
+  const double t2 = push_pop_workload<heap_type>(n, checksum);
+  std::cout << name << ": " << t1 << " s (collapse), "
+            << t2 << " s (push/pop)  [" << checksum << "]" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  std::cout << n << " elements" << std::endl;
+
+  run<CGAL::CGAL_BOOST_PENDING_MUTABLE_QUEUE>("mutable_queue", n);
+  run<CGAL::CGAL_BOOST_PENDING_RELAXED_HEAP>("relaxed_heap ", n);
+  run<CGAL::CGAL_BOOST_PAIRING_HEAP>("pairing_heap ", n);
+  run<CGAL::CGAL_D_ARY_HEAP>("d_ary_heap   ", n);
+
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 
 #include <iterator>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 #include <cstring>
 #include <cstddef>
@@ -154,7 +155,8 @@ public:
   void merge(Free_list &other)
   {
     if (m_head == nullptr) {
-      *this = other;
+      m_head = other.m_head;
+      set_size(other.m_size);
     }
     else if (!other.empty())
     {
@@ -162,7 +164,7 @@ public:
       while (CCC::clean_pointee(p) != nullptr)
         p = CCC::clean_pointee(p);
       CCC::set_type(p, other.m_head, CCC::FREE);
-      m_size += other.m_size;
+      set_size(m_size + other.m_size);
     }
     other.init(); // clear other
   }
@@ -189,11 +191,42 @@ protected:
 #endif // CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
 };
 
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+// Blocks allocated by one thread and not yet linked to the blocks of the container.
+// Only the owner thread modifies it, except in `link_thread_blocks()`, which
+// is called when no thread is inserting. `capacity` can be read by any thread.
+template< typename pointer, typename size_type >
+struct CCC_block_arena {
+  CCC_block_arena() : m_first(nullptr), m_last(nullptr),
+                      m_block_size(CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE),
+                      m_capacity(0) {}
+
+  void init() {
+    m_first = nullptr;
+    m_last = nullptr;
+    m_items.clear();
+    m_block_size = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
+    m_capacity.store(0, std::memory_order_relaxed);
+  }
+
+  std::vector<std::pair<pointer, size_type> > m_items;
+  pointer m_first;
+  pointer m_last;
+  size_type m_block_size;
+  std::atomic<size_type> m_capacity;
+};
+#endif // CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+
 // Class Concurrent_compact_container
 //
 // Safe concurrent "insert" and "erase".
 // Do not parse the container while others are modifying it.
 //
+// If the macro CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS is set to 1,
+// each thread allocates its blocks without locking, with its own block size
+// and capacity counter. The blocks of all threads are linked together lazily,
+// the first time the container is parsed after insertions.
+//
 template < class T, class Allocator_ = Default >
 class Concurrent_compact_container
 {
@@ -225,6 +258,10 @@ public:
 private:
   typedef Free_list<pointer, size_type, Self>       FreeList;
   typedef tbb::enumerable_thread_specific<FreeList> Free_lists;
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+  typedef CCC_block_arena<pointer, size_type>       Block_arena;
+  typedef tbb::enumerable_thread_specific<Block_arena> Block_arenas;
+#endif
 
   // FreeList can access our private function (clean_pointee...)
   friend class Free_list<pointer, size_type, Self>;
@@ -291,6 +328,8 @@ public:
 
   void swap(Self &c)
   {
+    link_thread_blocks();
+    c.link_thread_blocks();
     std::swap(m_alloc, c.m_alloc);
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     // non-atomic swap of m_capacity
@@ -312,11 +351,11 @@ public:
     a.swap(b);
   }
 
-  iterator begin() { return empty()?end():iterator(m_first_item, 0, 0); }
-  iterator end()   { return iterator(m_last_item, 0); }
+  iterator begin() { link_thread_blocks(); return empty()?end():iterator(m_first_item, 0, 0); }
+  iterator end()   { link_thread_blocks(); return iterator(m_last_item, 0); }
 
-  const_iterator begin() const { return empty()?end():const_iterator(m_first_item, 0, 0); }
-  const_iterator end()   const { return const_iterator(m_last_item, 0); }
+  const_iterator begin() const { link_thread_blocks(); return empty()?end():const_iterator(m_first_item, 0, 0); }
+  const_iterator end()   const { link_thread_blocks(); return const_iterator(m_last_item, 0); }
 
   reverse_iterator rbegin() { return reverse_iterator(end()); }
   reverse_iterator rend()   { return reverse_iterator(begin()); }
@@ -416,11 +455,7 @@ public:
   // Do not call this function while others are inserting/erasing elements
   size_type size() const
   {
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    size_type size = m_capacity.load(std::memory_order_relaxed);
-#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    size_type size = m_capacity;
-#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
+    size_type size = capacity();
     for( typename Free_lists::iterator it_free_list = m_free_lists.begin() ;
          it_free_list != m_free_lists.end() ;
          ++it_free_list )
@@ -433,7 +468,7 @@ public:
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   size_type approximate_size() const
   {
-    size_type size = m_capacity.load(std::memory_order_relaxed);
+    size_type size = capacity();
     for( typename Free_lists::iterator it_free_list = m_free_lists.begin() ;
          it_free_list != m_free_lists.end() ;
          ++it_free_list )
@@ -452,10 +487,16 @@ public:
   size_type capacity() const
   {
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    return m_capacity.load(std::memory_order_relaxed);
+    size_type capacity = m_capacity.load(std::memory_order_relaxed);
 #else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    return m_capacity;
+    size_type capacity = m_capacity;
 #endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+    // the thread-local counters are only merged when the blocks are linked
+    for(const Block_arena& arena : m_block_arenas)
+      capacity += arena.m_capacity.load(std::memory_order_relaxed);
+#endif
+    return capacity;
   }
 
   // void resize(size_type sz, T c = T()); // TODO  makes sense ???
@@ -485,6 +526,7 @@ public:
     const_pointer c = &*cit;
     size_type res=0;
 
+    link_thread_blocks();
     Mutex::scoped_lock lock(m_mutex);
 
     for (typename All_items::const_iterator it = m_all_items.begin(),
@@ -521,6 +563,7 @@ public:
 
     const_pointer c = &*cit;
 
+    link_thread_blocks();
     Mutex::scoped_lock lock(m_mutex);
 
     for (typename All_items::const_iterator it = m_all_items.begin(), itend = m_all_items.end();
@@ -600,6 +643,56 @@ private:
 
   void allocate_new_block(FreeList *fl);
 
+  // Appends the chain of blocks from `first` to `last` to the blocks of the container.
+  void append_blocks(pointer first, pointer last) const
+  {
+    if (m_last_item == nullptr) { // empty...
+      m_first_item = first;
+      m_last_item  = last;
+    } else if (last != nullptr) {
+      set_type(m_last_item, first, BLOCK_BOUNDARY);
+      set_type(first, m_last_item, BLOCK_BOUNDARY);
+      m_last_item = last;
+    }
+  }
+
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+  // Links the blocks allocated by the threads since the last call to the blocks
+  // of the container. Must not be called while others are inserting elements.
+  void link_thread_blocks() const
+  {
+    if (!m_has_thread_blocks.load(std::memory_order_acquire))
+      return;
+
+    Mutex::scoped_lock lock(m_mutex);
+    if (!m_has_thread_blocks.load(std::memory_order_relaxed))
+      return;
+
+    for (Block_arena& arena : m_block_arenas)
+    {
+      if (arena.m_first == nullptr)
+        continue;
+
+      append_blocks(arena.m_first, arena.m_last);
+      m_all_items.insert(m_all_items.end(), arena.m_items.begin(), arena.m_items.end());
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
+      m_capacity.fetch_add(arena.m_capacity.load(std::memory_order_relaxed), std::memory_order_relaxed);
+#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
+      m_capacity += arena.m_capacity.load(std::memory_order_relaxed);
+#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
+
+      // the block size keeps growing
+      arena.m_first = nullptr;
+      arena.m_last = nullptr;
+      arena.m_items.clear();
+      arena.m_capacity.store(0, std::memory_order_relaxed);
+    }
+    m_has_thread_blocks.store(false, std::memory_order_release);
+  }
+#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+  void link_thread_blocks() const {}
+#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+
   void put_on_free_list(pointer x, FreeList * fl)
   {
     set_type(x, fl->head(), FREE);
@@ -688,21 +781,32 @@ private:
     m_last_item  = nullptr;
     m_all_items  = All_items();
     m_time_stamp = 0;
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+    for (Block_arena& arena : m_block_arenas)
+      arena.init();
+    m_has_thread_blocks = false;
+#endif
   }
 
+  // The members modified by `link_thread_blocks()` are mutable,
+  // as the blocks are linked lazily by `begin()` and `end()`.
   allocator_type    m_alloc;
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  std::atomic<size_type> m_capacity = {};
+  mutable std::atomic<size_type> m_capacity = {};
 #else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  size_type         m_capacity      = {};
+  mutable size_type m_capacity      = {};
 #endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   size_type         m_block_size    = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
   Free_lists        m_free_lists;
-  pointer           m_first_item    = nullptr;
-  pointer           m_last_item     = nullptr;
-  All_items         m_all_items     = {};
+  mutable pointer   m_first_item    = nullptr;
+  mutable pointer   m_last_item     = nullptr;
+  mutable All_items m_all_items     = {};
   mutable Mutex     m_mutex;
   time_stamp_t      m_time_stamp    = {};
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+  mutable Block_arenas      m_block_arenas;
+  mutable std::atomic<bool> m_has_thread_blocks = {false};
+#endif
 
 };
 
@@ -711,6 +815,9 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
 {
   CGAL_precondition(&d != this);
 
+  link_thread_blocks();
+  d.link_thread_blocks();
+
   // Allocators must be "compatible" :
   CGAL_precondition(get_allocator() == d.get_allocator());
 
@@ -737,14 +844,7 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
     it_free_list->merge(*it_free_list_d);
   }
   // Concatenate the blocks.
-  if (m_last_item == nullptr) { // empty...
-    m_first_item = d.m_first_item;
-    m_last_item  = d.m_last_item;
-  } else if (d.m_last_item != nullptr) {
-    set_type(m_last_item, d.m_first_item, BLOCK_BOUNDARY);
-    set_type(d.m_first_item, m_last_item, BLOCK_BOUNDARY);
-    m_last_item = d.m_last_item;
-  }
+  append_blocks(d.m_first_item, d.m_last_item);
   m_all_items.insert(m_all_items.end(), d.m_all_items.begin(), d.m_all_items.end());
   // Add the capacities.
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
@@ -761,6 +861,7 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
 template < class T, class Allocator >
 void Concurrent_compact_container<T, Allocator>::clear()
 {
+  link_thread_blocks();
   for (typename All_items::iterator it = m_all_items.begin(), itend = m_all_items.end();
        it != itend; ++it) {
     pointer p = it->first;
@@ -784,6 +885,34 @@ void Concurrent_compact_container<T, Allocator>::
   size_type old_block_size;
   pointer new_block;
 
+#if CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
+  {
+    // The new block is chained to the blocks of the thread, without locking.
+    Block_arena& arena = m_block_arenas.local();
+    old_block_size = arena.m_block_size;
+    new_block = m_alloc.allocate(old_block_size + 2);
+    arena.m_items.push_back(std::make_pair(new_block, old_block_size + 2));
+    arena.m_capacity.store(arena.m_capacity.load(std::memory_order_relaxed) + old_block_size,
+                           std::memory_order_relaxed);
+
+    if (arena.m_last == nullptr)
+    {
+      arena.m_first = new_block;
+      set_type(arena.m_first, nullptr, START_END);
+    }
+    else
+    {
+      set_type(arena.m_last, new_block, BLOCK_BOUNDARY);
+      set_type(new_block, arena.m_last, BLOCK_BOUNDARY);
+    }
+    arena.m_last = new_block + old_block_size + 1;
+    set_type(arena.m_last, nullptr, START_END);
+    arena.m_block_size += CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
+
+    if (!m_has_thread_blocks.load(std::memory_order_relaxed))
+      m_has_thread_blocks.store(true, std::memory_order_relaxed);
+  }
+#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
   {
     Mutex::scoped_lock lock(m_mutex);
     old_block_size = m_block_size;
@@ -812,6 +941,7 @@ void Concurrent_compact_container<T, Allocator>::
     // Increase the m_block_size for the next time.
     m_block_size += CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
   }
+#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_PER_THREAD_BLOCKS
 
   // We don't touch the first and the last one.
   // We mark them free in reverse order, so that the insertion order
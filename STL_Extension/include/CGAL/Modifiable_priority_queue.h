@@ -21,10 +21,11 @@
 
 #include <algorithm>
 #include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
-enum Heap_type { CGAL_BOOST_PAIRING_HEAP, CGAL_BOOST_PENDING_MUTABLE_QUEUE, CGAL_BOOST_PENDING_RELAXED_HEAP };
+enum Heap_type { CGAL_BOOST_PAIRING_HEAP, CGAL_BOOST_PENDING_MUTABLE_QUEUE, CGAL_BOOST_PENDING_RELAXED_HEAP, CGAL_D_ARY_HEAP };
 
 template <class IndexedType_
          ,class Compare_ = std::less<IndexedType_>
@@ -270,6 +271,217 @@ private:
   std::vector<handle_type> mHandles;
 };
 
+// An indexed 4-ary heap: the values are stored contiguously in a vector, and the position
+// of each value in this vector is stored in a second vector indexed by the ID of the value.
+// Compared to node-based heaps, there is no allocation after the first `reserve()`,
+// and the children of a node share a cache line when the value type is small
+// (e.g. a descriptor). Sifts move a hole instead of swapping values.
+template <class IndexedType_
+         ,class Compare_
+         ,class ID_>
+struct Modifiable_priority_queue<IndexedType_, Compare_, ID_, CGAL_D_ARY_HEAP>
+{
+  typedef Modifiable_priority_queue Self;
+
+  typedef IndexedType_ IndexedType;
+  typedef Compare_     Compare;
+  typedef ID_          ID;
+
+  typedef IndexedType  value_type;
+  typedef std::size_t  size_type;
+
+private:
+  static constexpr size_type arity = 4;
+  static constexpr size_type npos = size_type(-1);
+
+public:
+  Modifiable_priority_queue(size_type largest_ID,
+                            const Compare& c = Compare(),
+                            const ID& id = ID())
+    : mCompare(c)
+    , mID(id)
+    , mPositions(largest_ID, npos)
+  {
+    reserve(largest_ID);
+  }
+
+  Modifiable_priority_queue(const Modifiable_priority_queue&) = delete;
+  Modifiable_priority_queue& operator=(const Modifiable_priority_queue&) = delete;
+
+public:
+  void push(const value_type& v)
+  {
+    CGAL_precondition(!contains(v));
+    mHeap.push_back(v);
+    sift_up(mHeap.size() - 1, v);
+  }
+
+  void resize_and_push(const value_type& v)
+  {
+    auto vid = get(mID, v);
+    CGAL_precondition(0 <= vid);
+
+    if(size_type(vid) >= mPositions.size())
+      mPositions.resize(vid + 1, npos);
+
+    push(v);
+  }
+
+  void update(const value_type& v)
+  {
+    CGAL_precondition(contains(v));
+    const size_type i = mPositions[get(mID, v)];
+    if(i > 0 && mCompare(v, mHeap[parent(i)]))
+      sift_up(i, v);
+    else
+      sift_down(i, v);
+  }
+
+  void erase(const value_type& v)
+  {
+    CGAL_precondition(contains(v));
+    auto vid = get(mID, v);
+    const size_type i = mPositions[vid];
+    mPositions[vid] = npos;
+
+    const value_type last = mHeap.back();
+    mHeap.pop_back();
+    if(i == mHeap.size())
+      return;
+
+    if(i > 0 && mCompare(last, mHeap[parent(i)]))
+      sift_up(i, last);
+    else
+      sift_down(i, last);
+  }
+
+  const value_type& top() const
+  {
+    CGAL_precondition(!empty());
+    return mHeap.front();
+  }
+
+  void pop()
+  {
+    CGAL_precondition(!empty());
+    mPositions[get(mID, mHeap.front())] = npos;
+
+    const value_type last = mHeap.back();
+    mHeap.pop_back();
+    if(!mHeap.empty())
+      sift_down(0, last);
+  }
+
+  size_type size() const { return mHeap.size(); }
+
+  bool empty() const { return mHeap.empty(); }
+
+  void clear()
+  {
+    for(const value_type& v : mHeap)
+      mPositions[get(mID, v)] = npos;
+    mHeap.clear();
+  }
+
+  bool contains(const value_type& v)
+  {
+    auto vid = get(mID, v);
+    CGAL_precondition(0 <= vid && size_type(vid) < mPositions.size());
+    return mPositions[vid] != npos;
+  }
+
+  bool contains_with_bounds_check(const value_type& v)
+  {
+    auto vid = get(mID, v);
+    if(size_type(vid) >= mPositions.size())
+      return false;
+
+    return mPositions[vid] != npos;
+  }
+
+  std::optional<value_type> extract_top()
+  {
+    std::optional<value_type> r;
+    if(!empty())
+    {
+      value_type v = top();
+      pop();
+      r = std::optional<value_type>(v);
+    }
+
+    return r;
+  }
+
+  value_type top_and_pop()
+  {
+    CGAL_precondition(!empty());
+    value_type v = top();
+    pop();
+    return v;
+  }
+
+  void reserve(size_type r)
+  {
+    mHeap.reserve(r);
+  }
+
+private:
+  static size_type parent(size_type i) { return (i - 1) / arity; }
+  static size_type first_child(size_type i) { return arity * i + 1; }
+
+  void place(size_type i, const value_type& v)
+  {
+    mHeap[i] = v;
+    mPositions[get(mID, v)] = i;
+  }
+
+  // moves the hole at position `i` up until `v` can be placed in it
+  void sift_up(size_type i, const value_type& v)
+  {
+    while(i > 0)
+    {
+      const size_type p = parent(i);
+      if(!mCompare(v, mHeap[p]))
+        break;
+
+      place(i, mHeap[p]);
+      i = p;
+    }
+    place(i, v);
+  }
+
+  // moves the hole at position `i` down until `v` can be placed in it
+  void sift_down(size_type i, const value_type& v)
+  {
+    const size_type n = mHeap.size();
+    for(;;)
+    {
+      const size_type first = first_child(i);
+      if(first >= n)
+        break;
+
+      const size_type last = (std::min)(first + arity, n);
+      size_type best = first;
+      for(size_type c=first+1; c<last; ++c)
+        if(mCompare(mHeap[c], mHeap[best]))
+          best = c;
+
+      if(!mCompare(mHeap[best], v))
+        break;
+
+      place(i, mHeap[best]);
+      i = best;
+    }
+    place(i, v);
+  }
+
+private:
+  std::vector<value_type> mHeap;
+  Compare mCompare;
+  ID mID;
+  std::vector<size_type> mPositions;
+};
+
 } // namespace CGAL
 
 #endif // CGAL_MODIFIABLE_PRIORITY_QUEUE_H
@@ -1,6 +1,9 @@
 #include <CGAL/assertions.h>
 #include <CGAL/algorithm.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/Random.h>
+#include <algorithm>
+#include <vector>
 #include <iostream>
 #include <functional>
 
@@ -39,11 +42,12 @@ int queue_size(Queue& q,int n){
   return k;
 }
 
-int main()
+template <CGAL::Heap_type heap_type>
+void test()
 {
   //testing min-heap
-  typedef CGAL::Modifiable_priority_queue<Type*,Less,First_of_pair> Queue;
-  Queue q(45,Queue::Compare(),Queue::ID());
+  typedef CGAL::Modifiable_priority_queue<Type*,Less,First_of_pair,heap_type> Queue;
+  Queue q(45,typename Queue::Compare(),typename Queue::ID());
   assert( queue_size(q,45) == 0 );
   assert( q.empty() );
 
@@ -205,6 +209,64 @@ int main()
       assert(q.contains(&data[0]+9-k)==false);
   }
   assert( q.empty() );
+}
+
+// random operations, checked against a sorted scan
+template <CGAL::Heap_type heap_type>
+void test_random()
+{
+  typedef CGAL::Modifiable_priority_queue<Type*,Less,First_of_pair,heap_type> Queue;
+  const int n = 1000;
+  Queue q(n,typename Queue::Compare(),typename Queue::ID());
+
+  std::vector<Type> data;
+  data.reserve(n);
+  for (int i=0;i<n;++i)
+    data.push_back(Type(i,(i*7919)%1009));
+
+  CGAL::Random rnd(0);
+  std::vector<bool> in_queue(n,false);
+  for (int k=0;k<20*n;++k){
+    const int i = rnd.get_int(0,n);
+    const int op = rnd.get_int(0,4);
+    if (!in_queue[i]){
+      q.push(&data[i]);
+      in_queue[i]=true;
+    } else if (op==0){
+      q.erase(&data[i]);
+      in_queue[i]=false;
+    } else if (op==1){
+      data[i].second = rnd.get_int(0,1009);
+      q.update(&data[i]);
+    } else {
+      int min_value = 1009;
+      for (int j=0;j<n;++j)
+        if (in_queue[j]) min_value = (std::min)(min_value,data[j].second);
+      assert(q.top()->second==min_value);
+      in_queue[q.top()->first]=false;
+      q.pop();
+    }
+    assert(q.contains(&data[i])==in_queue[i]);
+  }
+
+  std::size_t nb = std::count(in_queue.begin(),in_queue.end(),true);
+  assert(q.size()==nb);
+  int previous = -1;
+  while (!q.empty()){
+    assert(q.top()->second>=previous);
+    previous = q.top()->second;
+    q.pop();
+    --nb;
+  }
+  assert(nb==0);
+}
+
+int main()
+{
+  test<CGAL::CGAL_BOOST_PENDING_MUTABLE_QUEUE>();
+  test<CGAL::CGAL_D_ARY_HEAP>();
+  test_random<CGAL::CGAL_D_ARY_HEAP>();
+  test_random<CGAL::CGAL_BOOST_PAIRING_HEAP>();
 
   std::cout << "OK" << std::endl;
 
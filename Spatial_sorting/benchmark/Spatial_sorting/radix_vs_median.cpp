@@ -0,0 +1,78 @@
+// Compares the timings of the median and radix policies of the Hilbert sort
+// and of the spatial sort, sequential and parallel, on random points.
+// Usage: radix_vs_median [number of points]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel  K;
+typedef K::Point_2                                           Point_2;
+typedef K::Point_3                                           Point_3;
+
+template <typename ConcurrencyTag, typename Point, typename Policy>
+double time_hilbert_sort(const std::vector<Point>& points, Policy policy)
+{
+  std::vector<Point> v(points);
+  CGAL::Real_timer timer;
+  timer.start();
+  CGAL::hilbert_sort<ConcurrencyTag>(v.begin(), v.end(), policy);
+  timer.stop();
+  return timer.time();
+}
+
+template <typename ConcurrencyTag, typename Point, typename Policy>
+double time_spatial_sort(const std::vector<Point>& points, Policy policy)
+{
+  std::vector<Point> v(points);
+  CGAL::Real_timer timer;
+  timer.start();
+  CGAL::spatial_sort<ConcurrencyTag>(v.begin(), v.end(), policy);
+  timer.stop();
+  return timer.time();
+}
+
+template <typename ConcurrencyTag, typename Point>
+void run(const std::vector<Point>& points, const std::string& name)
+{
+  std::cout << name << std::endl;
+  std::cout << "  hilbert_sort  median: " << time_hilbert_sort<ConcurrencyTag>(points, CGAL::Hilbert_sort_median_policy()) << " s"
+            << "  radix: " << time_hilbert_sort<ConcurrencyTag>(points, CGAL::Hilbert_sort_radix_policy()) << " s" << std::endl;
+  std::cout << "  spatial_sort  median: " << time_spatial_sort<ConcurrencyTag>(points, CGAL::Hilbert_sort_median_policy()) << " s"
+            << "  radix: " << time_spatial_sort<ConcurrencyTag>(points, CGAL::Hilbert_sort_radix_policy()) << " s" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  CGAL::Random rnd(0);
+
+  std::vector<Point_2> points_2;
+  points_2.reserve(n);
+  std::copy_n(CGAL::Random_points_in_square_2<Point_2>(1., rnd), n, std::back_inserter(points_2));
+
+  std::vector<Point_3> points_3;
+  points_3.reserve(n);
+  std::copy_n(CGAL::Random_points_in_cube_3<Point_3>(1., rnd), n, std::back_inserter(points_3));
+
+  std::cout << n << " random points" << std::endl;
+  run<CGAL::Sequential_tag>(points_2, "2D, sequential");
+  run<CGAL::Sequential_tag>(points_3, "3D, sequential");
+#ifdef CGAL_LINKED_WITH_TBB
+  run<CGAL::Parallel_tag>(points_2, "2D, parallel");
+  run<CGAL::Parallel_tag>(points_3, "3D, parallel");
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -38,12 +38,30 @@ struct Middle { };
 /*!
 \ingroup PkgSpatialSortingUtils
 
+`Radix` is a tag class. It can be used to parameterize a strategy policy
+in order to specify the strategy for spatial sorting.
+`Hilbert_policy<Radix>` can be passed
+as parameter to `hilbert_sort()` to choose the sorting policy.
+It is available in 2D and 3D only.
+
+\cgalModels{DefaultConstructible,CopyConstructible}
+
+\sa `Median`
+\sa `Middle`
+\sa `Hilbert_policy`
+\sa `Hilbert_sort_radix_policy`
+*/
+struct Radix { };
+
+/*!
+\ingroup PkgSpatialSortingUtils
+
 `Hilbert_policy` is a policy class which can be used to parameterize a strategy policy
 in order to specify the strategy for spatial sorting.
 `Hilbert_policy<Median>` or `Hilbert_policy<Middle>`
 can be passed  as parameter to `hilbert_sort()` to choose the sorting policy.
 
-\tparam Tag must be either `Median` or `Middle`.
+\tparam Tag must be `Median`, `Middle`, or `Radix`.
 
 \cgalModels{DefaultConstructible,CopyConstructible}
 
@@ -69,4 +87,11 @@ A typedef to `Hilbert_policy<Middle>`.
 */
 typedef Hilbert_policy<Middle>  Hilbert_sort_middle_policy;
 
+/*!
+\ingroup PkgSpatialSortingUtils
+
+A typedef to `Hilbert_policy<Radix>`.
+*/
+typedef Hilbert_policy<Radix>  Hilbert_sort_radix_policy;
+
 } /* end namespace CGAL */
@@ -16,7 +16,7 @@ Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_
 
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
-With parallelism enabled, sorting will be performed using up to eight threads.
+With parallelism enabled, the recursive subdivisions are sorted concurrently.
 Parallel sorting is available only when the median strategy policy (the default policy) is used.
 */
 template< typename Traits, typename PolicyTag, typename ConcurrencyTag = Sequential_tag  >
@@ -11,8 +11,11 @@ Given a range of `n` points:
 stopping when there are fewer than `threshold` points.
 </OL>
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+With parallelism enabled, the rounds are sorted concurrently.
 */
-template< typename Sort >
+template< typename Sort, typename ConcurrencyTag = Sequential_tag >
 class Multiscale_sort {
 public:
 
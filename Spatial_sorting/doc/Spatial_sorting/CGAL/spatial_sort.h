@@ -12,8 +12,8 @@ It sorts the range `[begin, end)` in place.
 
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
-With parallelism enabled, sorting will be performed using up to four threads in 2D,
-and up to eight threads in 3D.
+With parallelism enabled, the subdivisions of the Hilbert sort and the rounds
+of the multiscale sort are processed concurrently, in 2D, 3D, and dD.
 Parallel sorting is available only when the median strategy policy (the default policy) is used.
 
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
@@ -39,6 +39,7 @@ and calls its `operator()`.
 
 The `threshold_hilbert` is the minimal size of a point set to be
 subdivided recursively during Hilbert sorting, otherwise random order is used.
+It is ignored by `Hilbert_sort_radix_policy`, which orders all the points.
 The `threshold_multiscale` value is the minimal size for a sample to
 call Hilbert sort, otherwise random order is used.
 The `ratio` value is used to split the original set in two subsets,
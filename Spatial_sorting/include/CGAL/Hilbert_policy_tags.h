@@ -17,6 +17,7 @@ namespace CGAL {
 
 struct Middle {};
 struct Median {};
+struct Radix {};
 
 
 // A policy to select the sorting strategy.
@@ -26,6 +27,7 @@ struct Hilbert_policy {};
 
 typedef Hilbert_policy<Middle>      Hilbert_sort_middle_policy;
 typedef Hilbert_policy<Median>      Hilbert_sort_median_policy;
+typedef Hilbert_policy<Radix>       Hilbert_sort_radix_policy;
 
 } // namespace CGAL
 
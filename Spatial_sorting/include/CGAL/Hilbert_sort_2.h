@@ -15,6 +15,7 @@
 #include <CGAL/Hilbert_policy_tags.h>
 #include <CGAL/Hilbert_sort_median_2.h>
 #include <CGAL/Hilbert_sort_middle_2.h>
+#include <CGAL/Hilbert_sort_radix_2.h>
 
 namespace CGAL {
 
@@ -41,6 +42,16 @@ public:
   {}
 };
 
+template <class K, class ConcurrencyTag >
+class Hilbert_sort_2<K, Hilbert_sort_radix_policy, ConcurrencyTag >
+  : public Hilbert_sort_radix_2<K, ConcurrencyTag>
+{
+public:
+  Hilbert_sort_2 (const K &k=K(), std::ptrdiff_t limit=1 )
+    : Hilbert_sort_radix_2<K, ConcurrencyTag> (k,limit)
+  {}
+};
+
 } // namespace CGAL
 
 #endif//CGAL_HILBERT_SORT_2_H
@@ -13,12 +13,17 @@
 #define CGAL_HILBERT_SORT_MEDIAN_d_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
 #include <iterator>
 #include <vector>
 #include <CGAL/Hilbert_sort_base.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 
 namespace internal {
@@ -43,7 +48,7 @@ struct Hilbert_cmp_d
 
 } // namespace internal
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_median_d
 {
 public:
@@ -71,6 +76,13 @@ public:
   template <class RandomAccessIterator>
   void sort (RandomAccessIterator begin, RandomAccessIterator end,
              Starting_position start, int direction) const
+  {
+    sort (begin, end, start, direction, ConcurrencyTag());
+  }
+
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             Starting_position start, int direction, Sequential_tag) const
   {
     if (end - begin <= _limit)
       return;
@@ -119,17 +131,83 @@ public:
     /////////////start recursive calls
     last_dir = (direction + _dimension -1) % _dimension;
     // first step is special
-    sort( places[0], places[1], start, last_dir);
+    sort( places[0], places[1], start, last_dir, Sequential_tag());
 
     for(int i=1; i<two_to_dim-1; i +=2){
-      sort( places[i  ], places[i+1], start, dir[i+1]);
-      sort( places[i+1], places[i+2], start, dir[i+1]);
+      sort( places[i  ], places[i+1], start, dir[i+1], Sequential_tag());
+      sort( places[i+1], places[i+2], start, dir[i+1], Sequential_tag());
       start[dir[i+1]] = !  start[dir[i+1]];
       start[last_dir] = !  start[last_dir];
     }
 
     //last step is special
-    sort( places[two_to_dim-1], places[two_to_dim], start, last_dir);
+    sort( places[two_to_dim-1], places[two_to_dim], start, last_dir, Sequential_tag());
+  }
+
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             Starting_position start, int direction, Parallel_tag) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_USE(begin);
+    CGAL_USE(end);
+    CGAL_USE(start);
+    CGAL_USE(direction);
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    // Same as the sequential version, except that the splits of a level
+    // and the recursive calls are independent and run concurrently.
+    if ((end - begin) <= 8192 || // 2^13, same cutoff as in 2D
+        (end - begin) < two_to_dim ||
+        _dimension > 20 || two_to_dim != (1 << _dimension)) {
+      sort (begin, end, start, direction, Sequential_tag());
+      return;
+    }
+
+    const int nb_splits = two_to_dim;
+
+    std::vector<RandomAccessIterator> places(nb_splits +1);
+    std::vector<int>                  dir   (nb_splits +1);
+    places[0]=begin;
+    places[nb_splits]=end;
+
+    int current_dir = direction;
+    int current_level_step = nb_splits;
+    do{
+      const int level_step = current_level_step;
+      const int half_step = level_step/2;
+      const int level_dir = current_dir;
+      const bool orient = start[current_dir];
+      tbb::parallel_for (0, nb_splits / level_step, [&](int k)
+      {
+        const int left = k * level_step;
+        dir[left + half_step]    = level_dir;
+        places[left + half_step] = internal::hilbert_split
+                                   (places[left], places[left + level_step],
+                                    Cmp (level_dir, (k % 2 == 0) ? orient : !orient, _k));
+      });
+      current_level_step = half_step;
+      current_dir = (current_dir +1) % _dimension;
+    }while (current_dir != direction);
+
+    // starting positions and directions of the recursive calls, as in the sequential version
+    const int last_dir = (direction + _dimension -1) % _dimension;
+    std::vector<Starting_position> starts(nb_splits, start);
+    std::vector<int> directions(nb_splits, last_dir);
+    for(int i=1; i<two_to_dim-1; i +=2){
+      starts[i] = starts[i+1] = start;
+      directions[i] = directions[i+1] = dir[i+1];
+      start[dir[i+1]] = !  start[dir[i+1]];
+      start[last_dir] = !  start[last_dir];
+    }
+    starts[nb_splits-1] = start;
+
+    tbb::parallel_for (0, nb_splits, [&](int i)
+    {
+      sort (places[i], places[i+1], starts[i], directions[i], Parallel_tag());
+    });
+#endif
   }
 
   template <class RandomAccessIterator>
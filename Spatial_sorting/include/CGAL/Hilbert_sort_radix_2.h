@@ -0,0 +1,69 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_HILBERT_SORT_RADIX_2_H
+#define CGAL_HILBERT_SORT_RADIX_2_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/Hilbert_sort_radix_base.h>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace CGAL {
+
+// Sorts along the Hilbert curve of the bounding box of the points by computing
+// the Hilbert index of each point on a regular grid, then radix sorting the indices.
+// `limit` is ignored: all the points are ordered on the finest grid, which refines
+// the order that stopping the subdivision at `limit` points would give.
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_radix_2
+{
+public:
+  typedef K Kernel;
+  typedef typename Kernel::Point_2 Point;
+
+private:
+  Kernel _k;
+
+  struct Coordinates
+  {
+    const Kernel& _k;
+    Coordinates (const Kernel& k) : _k (k) {}
+
+    std::array<double, 2> operator() (const Point& p) const
+    {
+      return std::array<double, 2> {{ to_double (_k.compute_x_2_object() (p)),
+                                      to_double (_k.compute_y_2_object() (p)) }};
+    }
+  };
+
+public:
+  Hilbert_sort_radix_2 (const Kernel &k, std::ptrdiff_t /*limit*/ = 1)
+    : _k(k)
+  {}
+
+  template <class RandomAccessIterator>
+  void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    internal::hilbert_radix_sort<2, ConcurrencyTag> (begin, end, Coordinates (_k));
+  }
+};
+
+} // namespace CGAL
+
+#endif//CGAL_HILBERT_SORT_RADIX_2_H
@@ -0,0 +1,280 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_HILBERT_SORT_RADIX_BASE_H
+#define CGAL_HILBERT_SORT_RADIX_BASE_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+// Transition table of the Hilbert curve in dimension `D`
+// (C. Hamilton, "Compact Hilbert indices", 2006).
+// A state encodes the entry corner and the direction of the current cell;
+// `next[state][digit]` packs the next state and the `D` bits of the index
+// for the sub-cell `digit`, whose bit `i` is the bit of coordinate `i`.
+template <int D>
+struct Hilbert_transition_table
+{
+  std::array<std::array<std::uint16_t, (1 << D)>, (1 << D) * D> next;
+
+  Hilbert_transition_table()
+  {
+    const unsigned N = 1u << D, mask = N - 1;
+    auto rotate_right = [&](unsigned x, unsigned r) { r %= D; return ((x >> r) | (x << (D - r))) & mask; };
+    auto rotate_left  = [&](unsigned x, unsigned r) { r %= D; return ((x << r) | (x >> (D - r))) & mask; };
+    auto gray         = [](unsigned x) { return x ^ (x >> 1); };
+    auto gray_inverse = [&](unsigned x) { for (unsigned s = 1; s < unsigned(D); s <<= 1) x ^= x >> s; return x & mask; };
+    auto trailing_set_bits = [](unsigned x) { unsigned c = 0; for (; x & 1; x >>= 1) ++c; return c; };
+    auto entry        = [&](unsigned w) { return (w == 0) ? 0u : gray (2 * ((w - 1) / 2)); };
+    auto direction    = [&](unsigned w) { return (w == 0) ? 0u
+                                                 : trailing_set_bits ((w % 2 == 0) ? w - 1 : w) % D; };
+
+    for (unsigned e = 0; e < N; ++e)
+      for (unsigned d = 0; d < unsigned(D); ++d)
+        for (unsigned l = 0; l < N; ++l) {
+          const unsigned w  = gray_inverse (rotate_right (l ^ e, d + 1));
+          const unsigned e2 = e ^ rotate_left (entry (w), d + 1);
+          const unsigned d2 = (d + direction (w) + 1) % D;
+          next[e * D + d][l] = std::uint16_t (((e2 * D + d2) << D) | w);
+        }
+  }
+};
+
+// Index along the Hilbert curve of a point given by `D` integer coordinates
+// of `bits` bits each.
+template <int D>
+std::uint64_t hilbert_index (const std::array<std::uint32_t, D>& X, int bits)
+{
+  static const Hilbert_transition_table<D> table;
+
+  unsigned state = 0;
+  std::uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; --b) {
+    unsigned digit = 0;
+    for (int i = 0; i < D; ++i)
+      digit |= ((X[i] >> b) & 1u) << i;
+    const unsigned t = table.next[state][digit];
+    key = (key << D) | (t & ((1u << D) - 1));
+    state = t >> D;
+  }
+  return key;
+}
+
+// Stable LSD radix sort of `(key, index)` pairs, one byte per pass.
+// Passes on digits that are identical for all keys are skipped.
+// In parallel, the range is cut in blocks whose histograms are computed
+// and scattered concurrently.
+template <class ConcurrencyTag>
+void radix_sort_keys (std::vector<std::pair<std::uint64_t, std::size_t> >& keys)
+{
+  typedef std::pair<std::uint64_t, std::size_t> Key;
+
+  const std::size_t n = keys.size();
+  if (n < 2)
+    return;
+
+  std::uint64_t all_or = 0, all_and = ~std::uint64_t(0);
+  for (const Key& k : keys) {
+    all_or |= k.first;
+    all_and &= k.first;
+  }
+  const std::uint64_t varying = all_or & ~all_and;
+
+  std::size_t nb_blocks = 1;
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    nb_blocks = (std::min<std::size_t>)(64, (n + 65535) / 65536);
+#endif
+  const std::size_t block_size = (n + nb_blocks - 1) / nb_blocks;
+
+  const int digit_bits = 8;
+  const std::size_t nb_digits = std::size_t(1) << digit_bits;
+  const std::uint64_t digit_mask = nb_digits - 1;
+
+  std::vector<Key> buffer (n);
+  std::vector<std::size_t> offsets (nb_blocks * nb_digits);
+
+  for (int shift = 0; shift < 64; shift += digit_bits) {
+    if (((varying >> shift) & digit_mask) == 0)
+      continue;
+
+    auto histogram = [&](std::size_t b)
+    {
+      std::size_t* h = &offsets[b * nb_digits];
+      std::fill (h, h + nb_digits, 0);
+      const std::size_t last = (std::min)(n, (b + 1) * block_size);
+      for (std::size_t i = b * block_size; i < last; ++i)
+        ++h[(keys[i].first >> shift) & digit_mask];
+    };
+    auto scatter = [&](std::size_t b)
+    {
+      std::size_t* h = &offsets[b * nb_digits];
+      const std::size_t last = (std::min)(n, (b + 1) * block_size);
+      for (std::size_t i = b * block_size; i < last; ++i)
+        buffer[h[(keys[i].first >> shift) & digit_mask]++] = keys[i];
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (nb_blocks > 1)
+      tbb::parallel_for (std::size_t(0), nb_blocks, histogram);
+    else
+#endif
+      histogram (0);
+
+    // exclusive prefix sum, digit-major then block-major, to keep the sort stable
+    std::size_t sum = 0;
+    for (std::size_t d = 0; d < nb_digits; ++d)
+      for (std::size_t b = 0; b < nb_blocks; ++b) {
+        const std::size_t c = offsets[b * nb_digits + d];
+        offsets[b * nb_digits + d] = sum;
+        sum += c;
+      }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (nb_blocks > 1)
+      tbb::parallel_for (std::size_t(0), nb_blocks, scatter);
+    else
+#endif
+      scatter (0);
+
+    keys.swap (buffer);
+  }
+}
+
+// Sorts `[begin, end)` along the Hilbert curve of the bounding box of the points.
+// `Coordinates` maps a value of the range to its `D` coordinates as doubles.
+template <int D, class ConcurrencyTag, class RandomAccessIterator, class Coordinates>
+void hilbert_radix_sort (RandomAccessIterator begin, RandomAccessIterator end,
+                         const Coordinates& coordinates)
+{
+  typedef typename std::iterator_traits<RandomAccessIterator>::value_type Value;
+  typedef std::pair<std::uint64_t, std::size_t>                          Key;
+  typedef std::array<double, D>                                          Point;
+
+  const std::size_t n = end - begin;
+  if (n < 2)
+    return;
+
+  // 63 bits keys in 3D, 64 bits keys in 2D
+  const int bits = 64 / D;
+  const double max_coordinate = double((std::uint64_t(1) << bits) - 1);
+
+  std::vector<Point> points (n);
+  std::vector<Key> keys (n);
+
+  auto compute_coordinates = [&](std::size_t i) { points[i] = coordinates (begin[i]); };
+
+  Point mini, maxi;
+  mini.fill ( std::numeric_limits<double>::infinity());
+  maxi.fill (-std::numeric_limits<double>::infinity());
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    tbb::parallel_for (std::size_t(0), n, compute_coordinates);
+    typedef std::pair<Point, Point> Box;
+    Box box = tbb::parallel_reduce (tbb::blocked_range<std::size_t>(0, n), Box (mini, maxi),
+                                    [&](const tbb::blocked_range<std::size_t>& r, Box b)
+                                    {
+                                      for (std::size_t i = r.begin(); i != r.end(); ++i)
+                                        for (int d = 0; d < D; ++d) {
+                                          b.first[d]  = (std::min)(b.first[d],  points[i][d]);
+                                          b.second[d] = (std::max)(b.second[d], points[i][d]);
+                                        }
+                                      return b;
+                                    },
+                                    [](Box a, const Box& b)
+                                    {
+                                      for (int d = 0; d < D; ++d) {
+                                        a.first[d]  = (std::min)(a.first[d],  b.first[d]);
+                                        a.second[d] = (std::max)(a.second[d], b.second[d]);
+                                      }
+                                      return a;
+                                    });
+    mini = box.first;
+    maxi = box.second;
+  } else
+#endif
+  {
+    for (std::size_t i = 0; i < n; ++i) {
+      compute_coordinates (i);
+      for (int d = 0; d < D; ++d) {
+        mini[d] = (std::min)(mini[d], points[i][d]);
+        maxi[d] = (std::max)(maxi[d], points[i][d]);
+      }
+    }
+  }
+
+  // the same scale on all axes, so that the cells of the grid are cubes
+  double extent = 0;
+  for (int d = 0; d < D; ++d)
+    extent = (std::max)(extent, maxi[d] - mini[d]);
+  const double scale = (extent > 0) ? max_coordinate / extent : 0.;
+
+  auto compute_key = [&](std::size_t i)
+  {
+    std::array<std::uint32_t, D> X;
+    for (int d = 0; d < D; ++d)
+      X[d] = std::uint32_t ((std::min)(max_coordinate, (points[i][d] - mini[d]) * scale));
+    keys[i] = Key (hilbert_index<D> (X, bits), i);
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    tbb::parallel_for (std::size_t(0), n, compute_key);
+  else
+#endif
+    for (std::size_t i = 0; i < n; ++i)
+      compute_key (i);
+
+  std::vector<Point>().swap (points);
+
+  radix_sort_keys<ConcurrencyTag> (keys);
+
+  std::vector<Value> sorted (n);
+  auto gather = [&](std::size_t i) { sorted[i] = begin[keys[i].second]; };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    tbb::parallel_for (std::size_t(0), n, gather);
+  else
+#endif
+    for (std::size_t i = 0; i < n; ++i)
+      gather (i);
+
+  std::copy (sorted.begin(), sorted.end(), begin);
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif//CGAL_HILBERT_SORT_RADIX_BASE_H
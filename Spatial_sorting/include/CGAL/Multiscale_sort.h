@@ -14,12 +14,19 @@
 
 #include <CGAL/config.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <iterator>
 #include <cstddef>
+#include <vector>
 
 namespace CGAL {
 
-template <class Sort>
+template <class Sort, class ConcurrencyTag = Sequential_tag>
 class Multiscale_sort
 {
   Sort _sort;
@@ -35,15 +42,49 @@ public:
 
   template <class RandomAccessIterator>
   void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+    sort (begin, end, ConcurrencyTag());
+  }
+
+private:
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end, Sequential_tag) const
   {
     typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
     RandomAccessIterator middle = begin;
     if (end - begin >= _threshold) {
       middle = begin + difference_type (double(end - begin) * _ratio);
-      this->operator() (begin, middle);
+      sort (begin, middle, Sequential_tag());
     }
     _sort (middle, end);
   }
+
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end, Parallel_tag) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_USE(begin);
+    CGAL_USE(end);
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+    // the rounds are disjoint ranges that are sorted independently
+    std::vector<RandomAccessIterator> rounds(1, end);
+    RandomAccessIterator middle = end;
+    while (middle - begin >= _threshold) {
+      middle = begin + difference_type (double(middle - begin) * _ratio);
+      rounds.push_back(middle);
+    }
+    rounds.push_back(begin);
+
+    tbb::parallel_for (std::size_t(0), rounds.size() - 1, [&](std::size_t i)
+    {
+      _sort (rounds[i+1], rounds[i]);
+    });
+#endif
+  }
 };
 
 } // namespace CGAL
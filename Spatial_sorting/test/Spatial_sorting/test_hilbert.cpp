@@ -6,6 +6,7 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Cartesian_d.h>
 
+#include <CGAL/algorithm.h>
 #include <CGAL/Random.h>
 #include <CGAL/point_generators_2.h>
 #include <CGAL/point_generators_3.h>
@@ -293,6 +294,157 @@ int main ()
 
     std::cout << "OK." << std::endl;
   }
+  {
+    std::cout << "Testing 2D (radix policy): Generating "<<nb_points_2<<" random points... " << std::flush;
+
+    std::vector<Point_2> v;
+    v.reserve (nb_points_2);
+
+    CGAL::Random_points_in_square_2<Point_2> gen (1.0, random);
+
+    for (int i = 0; i < nb_points_2 - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_2> v2 (v), v3 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort (v.begin(), v.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    assert(v == v3);
+    std::sort (v.begin(),  v.end(),  K().less_xy_2_object());
+    std::sort (v2.begin(), v2.end(), K().less_xy_2_object());
+    assert(v == v2);
+
+    std::cout << "no points lost." << std::endl;
+  }
+  {
+    std::cout << "Testing 3D (radix policy): Generating "<<nb_points_3<<" random points... " << std::flush;
+
+    std::vector<Point_3> v;
+    v.reserve (nb_points_3);
+
+    CGAL::Random_points_in_cube_3<Point_3> gen (1.0, random);
+
+    for (int i = 0; i < nb_points_3 - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_3> v2 (v), v3 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort (v.begin(), v.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    assert(v == v3);
+    std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
+    std::sort (v2.begin(), v2.end(), K().less_xyz_3_object());
+    assert(v == v2);
+
+    std::cout << "no points lost." << std::endl;
+  }
+  {
+    int size=256;               // 2^(xd)   with x=4 d=2
+    double box_size = 15.0;     // 2^x -1
+    std::cout << "Testing 2D (radix policy): Generating "<<size<<" grid points... " << std::flush;
+    std::vector<Point_2> v;
+    v.reserve(size);
+
+    CGAL::points_on_square_grid_2 (box_size, (std::size_t)size,
+                                   std::back_inserter(v), Creator_2() );
+    CGAL::cpp98::random_shuffle (v.begin(), v.end());
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_2> v2 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort (v.begin(), v.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    // on a regular grid, the same curve as the median policy
+    CGAL::hilbert_sort (v2.begin(), v2.end(), CGAL::Hilbert_sort_median_policy());
+    assert(v == v2);
+    for (int i = 0; i < size-1; ++i)
+      assert(CGAL::abs(CGAL::squared_distance( v[i], v[i+1]) - 4.0) < 0.1 );
+
+    std::cout << "OK." << std::endl;
+  }
+  {
+    int size=512;              // 2^(xd)   with x=3 d=3
+    double box_size = 7.0;     // 2^x -1
+
+    std::cout << "Testing 3D (radix policy): Generating "<<size<<" grid points... " << std::flush;
+
+    std::vector<Point_3> v;
+    v.reserve(size);
+
+    CGAL::points_on_cube_grid_3 (box_size, (std::size_t)size,
+                                 std::back_inserter(v), Creator_3() );
+    CGAL::cpp98::random_shuffle (v.begin(), v.end());
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_3> v2 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort (v.begin(), v.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    // consecutive points are neighbors on the grid, and the curve has the
+    // same ends as the one of the median policy
+    CGAL::hilbert_sort (v2.begin(), v2.end(), CGAL::Hilbert_sort_median_policy());
+    assert(v.front() == v2.front() && v.back() == v2.back());
+    for (int i = 0; i < size-1; ++i)
+      assert(CGAL::abs(CGAL::squared_distance( v[i], v[i+1]) - 4.0) < 0.1 );
+
+    std::cout << "OK." << std::endl;
+  }
   {
     std::cout << "Testing Spherical (median policy): Generating "<<nb_points_3<<" random points... " << std::flush;
 
@@ -451,8 +603,18 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point> v3 (v2);
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag> (v3.begin(), v3.end(),CGAL::Hilbert_sort_median_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
     std::cout << "            Checking...          " << std::flush;
 
+    assert(v == v3);
     std::sort (v.begin(),  v.end(), Kd().less_lexicographically_d_object());
     std::sort (v2.begin(), v2.end(),Kd().less_lexicographically_d_object());
     assert(v == v2);
@@ -56,8 +56,16 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_2> v3 (v2);
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag> (v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+
     std::cout << "            Checking...          " << std::flush;
 
+    assert(v == v3);
     std::sort (v.begin(),  v.end(),  K().less_xy_2_object());
     std::sort (v2.begin(), v2.end(), K().less_xy_2_object());
     assert(v == v2);
@@ -86,8 +94,16 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_3> v3 (v2);
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag> (v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+
     std::cout << "            Checking...          " << std::flush;
 
+    assert(v == v3);
     std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
     std::sort (v2.begin(), v2.end(), K().less_xyz_3_object());
     assert(v == v2);
@@ -177,8 +193,16 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point> v3 (v2);
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag> (v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+
     std::cout << "            Checking...          " << std::flush;
 
+    assert(v == v3);
     std::sort (v.begin(),  v.end(), Kd().less_lexicographically_d_object());
     std::sort (v2.begin(), v2.end(),Kd().less_lexicographically_d_object());
     assert(v == v2);
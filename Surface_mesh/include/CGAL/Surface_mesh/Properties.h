@@ -18,13 +18,26 @@
 
 #include <CGAL/assertions.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 #include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <vector>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace CGAL {
 
 namespace Properties {
@@ -34,6 +47,99 @@ namespace Properties {
 /// @{
 
 /// @cond CGAL_DOCUMENT_INTERNALS
+
+/// Interface of the memory used by the property arrays, which can be changed at runtime.
+class Memory_resource
+{
+public:
+    virtual ~Memory_resource() {}
+
+    /// Allocate `bytes` bytes aligned to `alignment`.
+    virtual void* allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+    /// Free the memory returned by `allocate(bytes, alignment)`.
+    virtual void deallocate(void* p, std::size_t bytes, std::size_t alignment) = 0;
+};
+
+/// Memory resource aligning large allocations to 2MB, and asking the system
+/// to back them with transparent huge pages when it is possible (Linux),
+/// to reduce the TLB misses when accessing large arrays.
+class Huge_page_memory_resource : public Memory_resource
+{
+public:
+    static constexpr std::size_t huge_page_size = std::size_t(1) << 21;
+
+    Huge_page_memory_resource(std::size_t min_bytes = huge_page_size) : min_bytes_(min_bytes) {}
+
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (bytes < min_bytes_)
+            return ::operator new(bytes, std::align_val_t((std::max)(alignment, alignof(std::max_align_t))));
+
+        void* p = ::operator new(bytes, std::align_val_t(huge_page_size));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+        return p;
+    }
+
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment)
+    {
+        if (bytes < min_bytes_)
+            ::operator delete(p, std::align_val_t((std::max)(alignment, alignof(std::max_align_t))));
+        else
+            ::operator delete(p, std::align_val_t(huge_page_size));
+    }
+
+private:
+    std::size_t min_bytes_;
+};
+
+/// Allocator of the property arrays: allocates with the memory resource
+/// if it is not null, and with `std::allocator` otherwise.
+template <class T>
+class Property_allocator
+{
+public:
+    typedef T value_type;
+
+    // an array keeps its memory resource when another array is copied into it,
+    // and takes the one of the array it is moved from or swapped with
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    Property_allocator(Memory_resource* resource = nullptr) noexcept : resource_(resource) {}
+
+    template <class U>
+    Property_allocator(const Property_allocator<U>& other) noexcept : resource_(other.resource()) {}
+
+    T* allocate(std::size_t n)
+    {
+        if (resource_ == nullptr)
+            return std::allocator<T>().allocate(n);
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        if (resource_ == nullptr)
+            std::allocator<T>().deallocate(p, n);
+        else
+            resource_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    Memory_resource* resource() const { return resource_; }
+
+    template <class U>
+    bool operator==(const Property_allocator<U>& other) const { return resource_ == other.resource(); }
+    template <class U>
+    bool operator!=(const Property_allocator<U>& other) const { return resource_ != other.resource(); }
+
+private:
+    Memory_resource* resource_;
+};
+
 class Base_property_array
 {
 public:
@@ -65,6 +171,13 @@ public:
     /// Let two elements swap their storage place.
     virtual void swap(size_t i0, size_t i1) = 0;
 
+    /// Reorder the elements: element i becomes old element old_indices[i].
+    /// The array is resized to old_indices.size().
+    virtual void permute(const std::vector<size_t>& old_indices) = 0;
+
+    /// Move the elements to memory allocated by `resource` (`std::allocator` if null).
+    virtual void set_memory_resource(Memory_resource* resource) = 0;
+
     /// Return a deep copy of self.
     virtual Base_property_array* clone () const = 0;
 
@@ -100,13 +213,15 @@ class Property_array : public Base_property_array
 public:
 
     typedef T                                       value_type;
-    typedef std::vector<value_type>                 vector_type;
+    typedef Property_allocator<value_type>          allocator_type;
+    typedef std::vector<value_type, allocator_type> vector_type;
     typedef typename vector_type::reference         reference;
     typedef typename vector_type::const_reference   const_reference;
     typedef typename vector_type::iterator          iterator;
     typedef typename vector_type::const_iterator    const_iterator;
 
-    Property_array(const std::string& name, T t=T()) : Base_property_array(name), value_(t) {}
+    Property_array(const std::string& name, T t=T(), Memory_resource* resource=nullptr)
+      : Base_property_array(name), data_(allocator_type(resource)), value_(t) {}
 
 public: // virtual interface of Base_property_array
 
@@ -164,19 +279,40 @@ public: // virtual interface of Base_property_array
         data_[i1]=d;
     }
 
+    virtual void permute(const std::vector<size_t>& old_indices)
+    {
+        vector_type d(data_.get_allocator());
+        d.reserve(old_indices.size());
+        for (std::size_t i=0; i<old_indices.size(); ++i)
+            d.push_back(data_[old_indices[i]]);
+        data_.swap(d);
+    }
+
+    virtual void set_memory_resource(Memory_resource* resource)
+    {
+        if (data_.get_allocator().resource() == resource)
+            return;
+        vector_type d{allocator_type(resource)};
+        d.reserve(data_.capacity());
+        d.insert(d.end(), data_.begin(), data_.end());
+        data_.swap(d);
+    }
+
     virtual Base_property_array* clone() const
     {
-        Property_array<T>* p = new Property_array<T>(this->name_, this->value_);
+        Property_array<T>* p = new Property_array<T>(this->name_, this->value_, memory_resource());
         p->data_ = data_;
         return p;
     }
 
     virtual Base_property_array* empty_clone() const
     {
-        Property_array<T>* p = new Property_array<T>(this->name_, this->value_);
+        Property_array<T>* p = new Property_array<T>(this->name_, this->value_, memory_resource());
         return p;
     }
 
+    Memory_resource* memory_resource() const { return data_.get_allocator().resource(); }
+
     virtual const std::type_info& type() const { return typeid(T); }
 
 
@@ -257,6 +393,7 @@ public:
             parrays_.resize(_rhs.n_properties());
             size_ = _rhs.size();
             capacity_ = _rhs.capacity();
+            resource_ = _rhs.resource_;
             for (std::size_t i=0; i<parrays_.size(); ++i)
                 parrays_[i] = _rhs.parrays_[i]->clone();
         }
@@ -271,16 +408,30 @@ public:
     }
 
 
+    // copy the content of the arrays of `_rhs` at the end of the arrays with the same name and type
+    template <typename ConcurrencyTag = Sequential_tag>
     void transfer(const Property_container& _rhs)
     {
-      for(std::size_t i=0; i<parrays_.size(); ++i){
+      auto transfer_array = [&](std::size_t i)
+      {
         for (std::size_t j=0; j<_rhs.parrays_.size(); ++j){
           if(parrays_[i]->is_same (*(_rhs.parrays_[j]))){
             parrays_[i]->transfer(* _rhs.parrays_[j]);
             break;
           }
         }
-      }
+      };
+
+#ifndef CGAL_LINKED_WITH_TBB
+      static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                     "Parallel_tag is enabled but TBB is unavailable.");
+#else
+      if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+        tbb::parallel_for(std::size_t(0), parrays_.size(), transfer_array);
+      else
+#endif
+        for(std::size_t i=0; i<parrays_.size(); ++i)
+          transfer_array(i);
     }
 
     // Copy properties that don't already exist from another container
@@ -366,7 +517,7 @@ public:
         }
 
         // otherwise add the property
-        Property_array<T>* p = new Property_array<T>(name, t);
+        Property_array<T>* p = new Property_array<T>(name, t, resource_);
         p->reserve(capacity_);
         p->resize(size_);
         parrays_.push_back(p);
@@ -501,18 +652,48 @@ public:
             parrays_[i]->swap(i0, i1);
     }
 
+    // reorder the elements of all arrays, see Base_property_array::permute()
+    template <typename ConcurrencyTag = Sequential_tag>
+    void permute(const std::vector<size_t>& old_indices)
+    {
+#ifndef CGAL_LINKED_WITH_TBB
+        static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                       "Parallel_tag is enabled but TBB is unavailable.");
+#else
+        if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+            tbb::parallel_for(std::size_t(0), parrays_.size(),
+                              [&](std::size_t i) { parrays_[i]->permute(old_indices); });
+        else
+#endif
+            for (std::size_t i=0; i<parrays_.size(); ++i)
+                parrays_[i]->permute(old_indices);
+        size_ = capacity_ = old_indices.size();
+    }
+
+    // allocate all arrays, and the ones added later, with `resource` (`std::allocator` if null)
+    void set_memory_resource(Memory_resource* resource)
+    {
+        for (std::size_t i=0; i<parrays_.size(); ++i)
+            parrays_[i]->set_memory_resource(resource);
+        resource_ = resource;
+    }
+
+    Memory_resource* memory_resource() const { return resource_; }
+
     // swap content with other Property_container
     void swap (Property_container& other)
     {
       this->parrays_.swap (other.parrays_);
       std::swap(this->size_, other.size_);
       std::swap(this->capacity_, other.capacity_);
+      std::swap(this->resource_, other.resource_);
     }
 
 private:
     std::vector<Base_property_array*>  parrays_;
     size_t  size_ = 0;
     size_t  capacity_ = 0;
+    Memory_resource* resource_ = nullptr;
 };
 
   /// @endcond
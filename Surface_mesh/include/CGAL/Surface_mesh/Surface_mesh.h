@@ -34,6 +34,11 @@
 #include <CGAL/Iterator_range.h>
 #include <CGAL/property_map.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <boost/cstdint.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 
@@ -1388,17 +1393,45 @@ public:
     bool has_garbage() const { return garbage_; }
 
     /// really removes vertices, halfedges, edges, and faces which are marked removed.
+    /// The last elements which are not removed are moved to the free places.
+    ///
+    /// \tparam ConcurrencyTag enables a parallel computation of the new indices,
+    ///         and a parallel compaction of the properties and of the connectivity.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///         The new indices do not depend on this tag.
+    ///
     /// \sa `has_garbage()`
     /// \attention By garbage collecting elements get new indices.
     /// In case you store indices in an auxiliary data structure
     /// or in a property these indices are potentially no longer
     /// referring to the right elements.
+    template <typename ConcurrencyTag = Sequential_tag>
     void collect_garbage();
 
     //undocumented convenience function that allows to get old-index->new-index information
     template <typename Visitor>
     void collect_garbage(Visitor& visitor);
 
+    /// reorders the elements of the mesh: the `i`-th vertex of `vertex_order` gets
+    /// the index `i`, and similarly for edges and faces. The two halfedges of an edge
+    /// follow it. All properties are permuted accordingly.
+    /// An empty range keeps the current order of the corresponding elements.
+    ///
+    /// \tparam ConcurrencyTag enables a parallel permutation of the properties and of the connectivity.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \pre `has_garbage()` is `false`.
+    /// \pre Each non-empty range contains every element of its type exactly once.
+    ///
+    /// \attention Elements get new indices, which invalidates the indices stored
+    /// in an auxiliary data structure or in a property.
+    ///
+    /// \sa `reorder_spatially()`, `reorder_breadth_first()`
+    template <typename ConcurrencyTag = Sequential_tag>
+    void reorder(const std::vector<Vertex_index>& vertex_order,
+                 const std::vector<Edge_index>& edge_order,
+                 const std::vector<Face_index>& face_order);
+
     /// controls the recycling or not of simplices previously marked as removed
     /// upon addition of new elements.
     /// When set to `true` (default value), new elements are first picked in the garbage (if any)
@@ -1408,6 +1441,39 @@ public:
     /// Getter
     bool does_recycle_garbage() const;
 
+    /// is the base class of the memory resources that can be used to allocate
+    /// the connectivity, the points, and the other properties of the mesh.
+    /// A memory resource overrides the functions
+    /// `void* allocate(std::size_t bytes, std::size_t alignment)` and
+    /// `void deallocate(void* p, std::size_t bytes, std::size_t alignment)`.
+    /// It can for example allocate from an arena, from a memory mapped file, or
+    /// from memory local to a NUMA node.
+    typedef Properties::Memory_resource Memory_resource;
+
+    /// is a memory resource aligning the allocations larger than 2MB to 2MB,
+    /// and asking the system to back them with transparent huge pages when it is
+    /// possible (Linux), which reduces the TLB misses when traversing large meshes.
+    typedef Properties::Huge_page_memory_resource Huge_page_memory_resource;
+
+    /// allocates all the properties of the mesh, including the connectivity, the points,
+    /// and the properties added later, with `resource`, or with `std::allocator`
+    /// if `resource` is null. The existing properties are moved to the new memory.
+    /// The memory resource is also used by the copies of the mesh, and must outlive them.
+    void set_memory_resource(Memory_resource* resource)
+    {
+        vprops_.set_memory_resource(resource);
+        hprops_.set_memory_resource(resource);
+        eprops_.set_memory_resource(resource);
+        fprops_.set_memory_resource(resource);
+    }
+
+    /// returns the memory resource used to allocate the properties of the mesh,
+    /// or null if they are allocated with `std::allocator`.
+    Memory_resource* memory_resource() const
+    {
+        return vprops_.memory_resource();
+    }
+
     /// @cond CGAL_DOCUMENT_INTERNALS
     /// removes unused memory from vectors. This shrinks the storage
     /// of all properties to the minimal required size.
@@ -2205,6 +2271,29 @@ private: //--------------------------------------------------- helper functions
     /// if `v` is a border vertex.
     void adjust_incoming_halfedge(Vertex_index v);
 
+    /// calls `f(i)` for each `i` in `[0, n)`, in parallel if `ConcurrencyTag` is `Parallel_tag`.
+    template <typename ConcurrencyTag, typename Function>
+    static void for_each_index(std::size_t n, const Function& f);
+
+    /// computes the moves of the compaction of `n` elements, `n_kept` of which are not removed:
+    /// the i-th removed element of `[0, n_kept)` gets replaced by the i-th last element of
+    /// `[n_kept, n)` which is not removed.
+    template <typename ConcurrencyTag, typename Is_removed>
+    static void compaction(std::size_t n, std::size_t n_kept, const Is_removed& is_removed,
+                           std::vector<std::size_t>& old_index, std::vector<size_type>& new_index);
+
+    /// moves the elements and their properties: the element `i` becomes the element `old_v[i]`
+    /// (resp. `old_e[i]`, `old_f[i]`), and the indices stored in the connectivity
+    /// are updated with `new_v`, `new_e`, and `new_f`. The arrays are resized to the size
+    /// of `old_v`, `old_e`, and `old_f`.
+    template <typename ConcurrencyTag>
+    void permute(const std::vector<std::size_t>& old_v,
+                 const std::vector<std::size_t>& old_e,
+                 const std::vector<std::size_t>& old_f,
+                 const std::vector<size_type>& new_v,
+                 const std::vector<size_type>& new_e,
+                 const std::vector<size_type>& new_f);
+
 private: //------------------------------------------------------- private data
     Properties::Property_container<Self, Vertex_index> vprops_;
     Properties::Property_container<Self, Halfedge_index> hprops_;
@@ -2712,6 +2801,172 @@ collect_garbage(Visitor &visitor)
     garbage_ = false;
 }
 
+template <typename P>
+template <typename ConcurrencyTag, typename Function>
+void
+Surface_mesh<P>::
+for_each_index(std::size_t n, const Function& f)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+                          {
+                              for (std::size_t i=r.begin(); i!=r.end(); ++i)
+                                  f(i);
+                          });
+    else
+#endif
+        for (std::size_t i=0; i<n; ++i)
+            f(i);
+}
+
+template <typename P>
+template <typename ConcurrencyTag, typename Is_removed>
+void
+Surface_mesh<P>::
+compaction(std::size_t n, std::size_t n_kept, const Is_removed& is_removed,
+           std::vector<std::size_t>& old_index, std::vector<size_type>& new_index)
+{
+    // positions of the elements of [first, first+size) satisfying `pred`, in increasing
+    // or decreasing order: the counts per block are summed (prefix sum over the blocks)
+    // to know where each block writes its positions
+    auto select = [](std::size_t first, std::size_t size, bool decreasing, const auto& pred)
+    {
+        const std::size_t block_size = 4096;
+        const std::size_t nb_blocks = (size + block_size - 1) / block_size;
+        auto position = [&](std::size_t i) { return decreasing ? first + size - 1 - i : first + i; };
+
+        std::vector<std::size_t> offsets(nb_blocks + 1, 0);
+        for_each_index<ConcurrencyTag>(nb_blocks, [&](std::size_t b)
+        {
+            for (std::size_t i=b*block_size; i<(std::min)(size, (b+1)*block_size); ++i)
+                if (pred(position(i)))
+                    ++offsets[b+1];
+        });
+        for (std::size_t b=0; b<nb_blocks; ++b)
+            offsets[b+1] += offsets[b];
+
+        std::vector<std::size_t> selected(offsets[nb_blocks]);
+        for_each_index<ConcurrencyTag>(nb_blocks, [&](std::size_t b)
+        {
+            std::size_t k = offsets[b];
+            for (std::size_t i=b*block_size; i<(std::min)(size, (b+1)*block_size); ++i)
+                if (pred(position(i)))
+                    selected[k++] = position(i);
+        });
+        return selected;
+    };
+
+    const std::vector<std::size_t> holes =
+        select(0, n_kept, false, [&](std::size_t i) { return is_removed(i); });
+    const std::vector<std::size_t> moved =
+        select(n_kept, n - n_kept, true, [&](std::size_t i) { return !is_removed(i); });
+    CGAL_assertion(holes.size() == moved.size());
+
+    old_index.resize(n_kept);
+    new_index.resize(n);
+    for_each_index<ConcurrencyTag>(n_kept, [&](std::size_t i)
+    {
+        old_index[i] = i;
+        new_index[i] = size_type(i);
+    });
+    for_each_index<ConcurrencyTag>(holes.size(), [&](std::size_t i)
+    {
+        old_index[holes[i]] = moved[i];
+        new_index[moved[i]] = size_type(holes[i]);
+    });
+}
+
+template <typename P>
+template <typename ConcurrencyTag>
+void
+Surface_mesh<P>::
+permute(const std::vector<std::size_t>& old_v,
+        const std::vector<std::size_t>& old_e,
+        const std::vector<std::size_t>& old_f,
+        const std::vector<size_type>& new_v,
+        const std::vector<size_type>& new_e,
+        const std::vector<size_type>& new_f)
+{
+    std::vector<std::size_t> old_h(2 * old_e.size());
+    for_each_index<ConcurrencyTag>(old_e.size(), [&](std::size_t i)
+    {
+        old_h[2*i] = 2*old_e[i];
+        old_h[2*i+1] = 2*old_e[i]+1;
+    });
+
+    vprops_.template permute<ConcurrencyTag>(old_v);
+    hprops_.template permute<ConcurrencyTag>(old_h);
+    eprops_.template permute<ConcurrencyTag>(old_e);
+    fprops_.template permute<ConcurrencyTag>(old_f);
+
+    // update connectivity
+    auto new_halfedge = [&](Halfedge_index h)
+    {
+        return h.is_valid() ? Halfedge_index(2*new_e[h.idx()/2] + h.idx()%2) : h;
+    };
+
+    for_each_index<ConcurrencyTag>(num_vertices(), [&](std::size_t i)
+    {
+        Vertex_connectivity& c = vconn_[Vertex_index(size_type(i))];
+        c.halfedge_ = new_halfedge(c.halfedge_);
+    });
+
+    for_each_index<ConcurrencyTag>(num_halfedges(), [&](std::size_t i)
+    {
+        Halfedge_connectivity& c = hconn_[Halfedge_index(size_type(i))];
+        c.vertex_ = Vertex_index(new_v[c.vertex_.idx()]);
+        c.next_halfedge_ = new_halfedge(c.next_halfedge_);
+        c.prev_halfedge_ = new_halfedge(c.prev_halfedge_);
+        if (c.face_.is_valid())
+            c.face_ = Face_index(new_f[c.face_.idx()]);
+    });
+
+    for_each_index<ConcurrencyTag>(num_faces(), [&](std::size_t i)
+    {
+        Face_connectivity& c = fconn_[Face_index(size_type(i))];
+        c.halfedge_ = new_halfedge(c.halfedge_);
+    });
+}
+
+template <typename P>
+template <typename ConcurrencyTag>
+void
+Surface_mesh<P>::
+reorder(const std::vector<Vertex_index>& vertex_order,
+        const std::vector<Edge_index>& edge_order,
+        const std::vector<Face_index>& face_order)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    CGAL_precondition(!has_garbage());
+
+    // old index of each element, and new index of each old element
+    auto permutation = [&](const auto& order, std::size_t n,
+                           std::vector<std::size_t>& old_index, std::vector<size_type>& new_index)
+    {
+        CGAL_precondition(order.empty() || order.size() == n);
+        old_index.resize(n);
+        new_index.resize(n);
+        for_each_index<ConcurrencyTag>(n, [&](std::size_t i)
+        {
+            old_index[i] = order.empty() ? i : std::size_t(order[i].idx());
+            new_index[old_index[i]] = size_type(i);
+        });
+    };
+
+    std::vector<std::size_t> old_v, old_e, old_f;
+    std::vector<size_type> new_v, new_e, new_f;
+    permutation(vertex_order, num_vertices(), old_v, new_v);
+    permutation(edge_order, num_edges(), old_e, new_e);
+    permutation(face_order, num_faces(), old_f, new_f);
+
+    permute<ConcurrencyTag>(old_v, old_e, old_f, new_v, new_e, new_f);
+}
+
 #ifndef DOXYGEN_RUNNING
 namespace collect_garbage_internal {
 struct Dummy_visitor{
@@ -2724,12 +2979,46 @@ struct Dummy_visitor{
 #endif
 
 template <typename P>
+template <typename ConcurrencyTag>
 void
 Surface_mesh<P>::
 collect_garbage()
 {
-  collect_garbage_internal::Dummy_visitor visitor;
-  collect_garbage(visitor);
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if constexpr (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    collect_garbage_internal::Dummy_visitor visitor;
+    collect_garbage(visitor);
+  }
+  else
+  {
+    if (!has_garbage())
+      return;
+
+    // same moves as the sequential version, which swaps the first removed
+    // element with the last element not removed until they meet
+    std::vector<std::size_t> old_v, old_e, old_f;
+    std::vector<size_type> new_v, new_e, new_f;
+    compaction<ConcurrencyTag>(num_vertices(), num_vertices() - removed_vertices_,
+                               [&](std::size_t i) { return vremoved_[Vertex_index(size_type(i))]; },
+                               old_v, new_v);
+    compaction<ConcurrencyTag>(num_edges(), num_edges() - removed_edges_,
+                               [&](std::size_t i) { return eremoved_[Edge_index(size_type(i))]; },
+                               old_e, new_e);
+    compaction<ConcurrencyTag>(num_faces(), num_faces() - removed_faces_,
+                               [&](std::size_t i) { return fremoved_[Face_index(size_type(i))]; },
+                               old_f, new_f);
+
+    permute<ConcurrencyTag>(old_v, old_e, old_f, new_v, new_e, new_f);
+
+    removed_vertices_ = removed_edges_ = removed_faces_ = 0;
+    vertices_freelist_ = edges_freelist_ = faces_freelist_ = -1;
+    garbage_ = false;
+  }
 }
 
 
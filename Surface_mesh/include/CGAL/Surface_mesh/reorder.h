@@ -0,0 +1,260 @@
+// Copyright (c) 2026  GeometryFactory (France). All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_SURFACE_MESH_REORDER_H
+#define CGAL_SURFACE_MESH_REORDER_H
+
+#include <CGAL/license/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+namespace Surface_mesh_reorder {
+
+// sorts the `n` indices of type `Index` by increasing key, keeping the current order
+// of indices with the same key (counting sort, `key(i) < nb_keys`)
+template <typename Index, typename KeyFunction>
+std::vector<Index> sort_by_key(std::size_t n, std::size_t nb_keys, const KeyFunction& key)
+{
+  typedef typename Index::size_type size_type;
+
+  std::vector<std::size_t> keys(n), offsets(nb_keys + 1, 0);
+  for(std::size_t i=0; i<n; ++i)
+  {
+    keys[i] = key(Index(size_type(i)));
+    ++offsets[keys[i] + 1];
+  }
+  for(std::size_t k=1; k<offsets.size(); ++k)
+    offsets[k] += offsets[k-1];
+
+  std::vector<Index> sorted(n);
+  for(std::size_t i=0; i<n; ++i)
+    sorted[offsets[keys[i]]++] = Index(size_type(i));
+  return sorted;
+}
+
+} // namespace Surface_mesh_reorder
+} // namespace internal
+
+/// \ingroup PkgSurface_mesh
+///
+/// reorders the elements of `sm` to improve the locality of memory accesses
+/// in traversals: the vertices are sorted along a Hilbert curve (see `hilbert_sort()`),
+/// and the edges and faces are sorted by the smallest new index of their vertices,
+/// so that the elements incident to a vertex are stored close to it.
+///
+/// If `sm` has garbage, `Surface_mesh::collect_garbage()` is called first.
+///
+/// \tparam P the point type of the mesh
+/// \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+///
+/// \param sm the surface mesh to reorder
+/// \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+///
+/// \cgalNamedParamsBegin
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the sort and the permutation should be done in parallel}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{geom_traits}
+///     \cgalParamDescription{an instance of a geometric traits class}
+///     \cgalParamType{a model of `SpatialSortingTraits_3`}
+///     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+///   \cgalParamNEnd
+/// \cgalNamedParamsEnd
+///
+/// \attention Elements get new indices, see `Surface_mesh::reorder()`.
+///
+/// \sa `reorder_breadth_first()`
+template <typename P, typename NamedParameters = parameters::Default_named_parameters>
+void reorder_spatially(Surface_mesh<P>& sm,
+                       const NamedParameters& np = parameters::default_values())
+{
+  typedef Surface_mesh<P>                                     Mesh;
+  typedef typename Mesh::Vertex_index                         Vertex_index;
+  typedef typename Mesh::Edge_index                           Edge_index;
+  typedef typename Mesh::Face_index                           Face_index;
+
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                        NamedParameters,
+                                                        Sequential_tag>::type Concurrency_tag;
+
+  typedef typename GetGeomTraits<Mesh, NamedParameters>::type GT;
+  const GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+
+  if(sm.has_garbage())
+    sm.collect_garbage();
+
+  // vertices
+  typedef typename Mesh::template Property_map<Vertex_index, P> Point_map;
+  typedef Spatial_sort_traits_adapter_3<GT, Point_map>           Search_traits;
+
+  std::vector<Vertex_index> vertex_order(sm.vertices().begin(), sm.vertices().end());
+  hilbert_sort<Concurrency_tag>(vertex_order.begin(), vertex_order.end(),
+                                Search_traits(sm.points(), gt));
+
+  std::vector<std::size_t> rank(sm.num_vertices());
+  for(std::size_t i=0; i<vertex_order.size(); ++i)
+    rank[vertex_order[i]] = i;
+
+  // edges and faces, next to their first vertex
+  std::vector<Edge_index> edge_order =
+    internal::Surface_mesh_reorder::sort_by_key<Edge_index>(
+      sm.num_edges(), sm.num_vertices(),
+      [&](Edge_index e)
+      {
+        return (std::min)(rank[sm.source(sm.halfedge(e))], rank[sm.target(sm.halfedge(e))]);
+      });
+
+  std::vector<Face_index> face_order =
+    internal::Surface_mesh_reorder::sort_by_key<Face_index>(
+      sm.num_faces(), sm.num_vertices(),
+      [&](Face_index f)
+      {
+        std::size_t key = rank[sm.target(sm.halfedge(f))];
+        for(Vertex_index v : sm.vertices_around_face(sm.halfedge(f)))
+          key = (std::min)(key, rank[v]);
+        return key;
+      });
+
+  sm.template reorder<Concurrency_tag>(vertex_order, edge_order, face_order);
+}
+
+/// \ingroup PkgSurface_mesh
+///
+/// reorders the elements of `sm` to improve the locality of memory accesses
+/// in traversals: the faces are sorted in the order of a breadth-first traversal
+/// of each connected component, and the vertices and edges in the order in which
+/// they are first reached by this traversal. Isolated vertices and edges not incident
+/// to any face are put at the end.
+///
+/// If `sm` has garbage, `Surface_mesh::collect_garbage()` is called first.
+///
+/// \tparam P the point type of the mesh
+/// \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+///
+/// \param sm the surface mesh to reorder
+/// \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+///
+/// \cgalNamedParamsBegin
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the permutation should be done in parallel}
+///     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///   \cgalParamNEnd
+/// \cgalNamedParamsEnd
+///
+/// \attention Elements get new indices, see `Surface_mesh::reorder()`.
+///
+/// \sa `reorder_spatially()`
+template <typename P, typename NamedParameters = parameters::Default_named_parameters>
+void reorder_breadth_first(Surface_mesh<P>& sm,
+                           const NamedParameters& np = parameters::default_values())
+{
+  typedef Surface_mesh<P>                                     Mesh;
+  typedef typename Mesh::Vertex_index                         Vertex_index;
+  typedef typename Mesh::Halfedge_index                       Halfedge_index;
+  typedef typename Mesh::Edge_index                           Edge_index;
+  typedef typename Mesh::Face_index                           Face_index;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                        NamedParameters,
+                                                        Sequential_tag>::type Concurrency_tag;
+  CGAL_USE(np);
+
+  if(sm.has_garbage())
+    sm.collect_garbage();
+
+  std::vector<Vertex_index> vertex_order;
+  std::vector<Edge_index> edge_order;
+  std::vector<Face_index> face_order;
+  vertex_order.reserve(sm.num_vertices());
+  edge_order.reserve(sm.num_edges());
+  face_order.reserve(sm.num_faces());
+
+  std::vector<bool> vertex_reached(sm.num_vertices(), false);
+  std::vector<bool> edge_reached(sm.num_edges(), false);
+  std::vector<bool> face_reached(sm.num_faces(), false);
+
+  // `face_order` is also the queue of the traversal
+  for(Face_index seed : sm.faces())
+  {
+    if(face_reached[seed])
+      continue;
+    face_reached[seed] = true;
+    face_order.push_back(seed);
+
+    for(std::size_t head = face_order.size() - 1; head < face_order.size(); ++head)
+    {
+      for(Halfedge_index h : sm.halfedges_around_face(sm.halfedge(face_order[head])))
+      {
+        const Vertex_index v = sm.target(h);
+        if(!vertex_reached[v])
+        {
+          vertex_reached[v] = true;
+          vertex_order.push_back(v);
+        }
+
+        const Edge_index e = sm.edge(h);
+        if(!edge_reached[e])
+        {
+          edge_reached[e] = true;
+          edge_order.push_back(e);
+        }
+
+        const Face_index f = sm.face(sm.opposite(h));
+        if(f != Mesh::null_face() && !face_reached[f])
+        {
+          face_reached[f] = true;
+          face_order.push_back(f);
+        }
+      }
+    }
+  }
+
+  for(Edge_index e : sm.edges())
+  {
+    if(edge_reached[e])
+      continue;
+    edge_order.push_back(e);
+    for(Vertex_index v : { sm.source(sm.halfedge(e)), sm.target(sm.halfedge(e)) })
+      if(!vertex_reached[v])
+      {
+        vertex_reached[v] = true;
+        vertex_order.push_back(v);
+      }
+  }
+
+  for(Vertex_index v : sm.vertices())
+    if(!vertex_reached[v])
+      vertex_order.push_back(v);
+
+  sm.template reorder<Concurrency_tag>(vertex_order, edge_order, face_order);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_REORDER_H
@@ -0,0 +1,95 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>     K;
+typedef K::Point_3                         Point_3;
+typedef CGAL::Surface_mesh<Point_3>        Sm;
+typedef Sm::Vertex_index                   Vertex_index;
+typedef Sm::Halfedge_index                 Halfedge_index;
+typedef Sm::Edge_index                     Edge_index;
+typedef Sm::Face_index                     Face_index;
+
+// the parallel garbage collection must give exactly the same mesh as the sequential one
+void compare(const Sm& a, const Sm& b)
+{
+  assert(a.num_vertices() == b.num_vertices());
+  assert(a.num_edges() == b.num_edges());
+  assert(a.num_faces() == b.num_faces());
+
+  for(Vertex_index v : a.vertices())
+  {
+    assert(a.point(v) == b.point(v));
+    assert(a.halfedge(v) == b.halfedge(v));
+  }
+  for(Halfedge_index h : a.halfedges())
+  {
+    assert(a.target(h) == b.target(h));
+    assert(a.next(h) == b.next(h));
+    assert(a.prev(h) == b.prev(h));
+    assert(a.face(h) == b.face(h));
+  }
+  for(Face_index f : a.faces())
+    assert(a.halfedge(f) == b.halfedge(f));
+
+  auto ida = a.property_map<Face_index, std::size_t>("f:id").value();
+  auto idb = b.property_map<Face_index, std::size_t>("f:id").value();
+  for(Face_index f : a.faces())
+    assert(ida[f] == idb[f]);
+}
+
+void test(double ratio)
+{
+  std::cout << "Removing " << ratio * 100 << "% of the faces" << std::endl;
+
+  Sm sm;
+  CGAL::make_grid(300, 200, sm);
+  auto id = sm.add_property_map<Face_index, std::size_t>("f:id").first;
+  for(Face_index f : sm.faces())
+    id[f] = std::size_t(f);
+
+  CGAL::Random rnd(0);
+  std::vector<Face_index> to_remove;
+  for(Face_index f : sm.faces())
+    if(rnd.get_double() < ratio)
+      to_remove.push_back(f);
+  for(Face_index f : to_remove)
+    CGAL::Euler::remove_face(sm.halfedge(f), sm);
+  assert(sm.has_garbage() == !to_remove.empty());
+
+  Sm seq = sm, par = sm;
+  seq.collect_garbage();
+  par.collect_garbage<CGAL::Parallel_if_available_tag>();
+
+  assert(!par.has_garbage());
+  assert(par.is_valid(false));
+  assert(par.number_of_removed_vertices() == 0 && par.number_of_removed_faces() == 0);
+  assert(par.num_faces() == par.number_of_faces());
+  compare(seq, par);
+
+  // elements can be added after the collection
+  Vertex_index u = par.add_vertex(Point_3(-1, -1, 0));
+  Vertex_index v = par.add_vertex(Point_3(-2, -1, 0));
+  Vertex_index w = par.add_vertex(Point_3(-1, -2, 0));
+  assert(par.add_face(u, v, w) != Sm::null_face());
+  assert(par.is_valid(false));
+}
+
+int main()
+{
+  test(0);
+  test(0.01);
+  test(0.5);
+  test(0.99);
+  test(1);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
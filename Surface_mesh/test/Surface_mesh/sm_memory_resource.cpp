@@ -0,0 +1,115 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh/reorder.h>
+
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+
+#include <cassert>
+#include <iostream>
+#include <new>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>     K;
+typedef K::Point_3                         Point_3;
+typedef CGAL::Surface_mesh<Point_3>        Sm;
+typedef Sm::Vertex_index                   Vertex_index;
+typedef Sm::Face_index                     Face_index;
+
+// counts the memory allocated through it
+struct Counting_memory_resource
+  : public Sm::Memory_resource
+{
+  std::size_t allocated = 0;
+  std::size_t nb_allocations = 0;
+
+  void* allocate(std::size_t bytes, std::size_t alignment)
+  {
+    allocated += bytes;
+    ++nb_allocations;
+    return ::operator new(bytes, std::align_val_t(alignment));
+  }
+
+  void deallocate(void* p, std::size_t bytes, std::size_t alignment)
+  {
+    assert(allocated >= bytes);
+    allocated -= bytes;
+    ::operator delete(p, std::align_val_t(alignment));
+  }
+};
+
+void test_counting()
+{
+  Counting_memory_resource resource;
+  {
+    Sm sm;
+    CGAL::make_grid(30, 20, sm);
+    auto id = sm.add_property_map<Face_index, std::size_t>("f:id").first;
+    for(Face_index f : sm.faces())
+      id[f] = std::size_t(f);
+
+    assert(sm.memory_resource() == nullptr);
+    sm.set_memory_resource(&resource);
+    assert(sm.memory_resource() == &resource);
+    assert(resource.allocated > 0);
+    assert(sm.is_valid(false));
+    for(Face_index f : sm.faces())
+      assert(id[f] == std::size_t(f));
+
+    // properties added later use the resource
+    std::size_t allocated = resource.allocated;
+    auto w = sm.add_property_map<Vertex_index, double>("v:weight", 1.).first;
+    assert(resource.allocated >= allocated + sm.num_vertices() * sizeof(double));
+    assert(w[*sm.vertices().begin()] == 1.);
+
+    // and so do the copies
+    Sm copy(sm);
+    assert(copy.memory_resource() == &resource);
+    Sm other;
+    other = sm;
+    assert(other.memory_resource() == &resource);
+
+    // the mesh can be edited, collected, and reordered
+    std::size_t nb_allocations = resource.nb_allocations;
+    std::vector<Face_index> to_remove;
+    for(Face_index f : sm.faces())
+      if(std::size_t(f) % 3 == 0)
+        to_remove.push_back(f);
+    for(Face_index f : to_remove)
+      CGAL::Euler::remove_face(sm.halfedge(f), sm);
+    sm.collect_garbage();
+    CGAL::reorder_spatially(sm);
+    sm.add_face(sm.add_vertex(Point_3(-1, -1, 0)), sm.add_vertex(Point_3(-2, -1, 0)), sm.add_vertex(Point_3(-1, -2, 0)));
+    assert(sm.is_valid(false));
+    assert(resource.nb_allocations > nb_allocations);
+
+    // going back to std::allocator
+    sm.set_memory_resource(nullptr);
+    assert(sm.memory_resource() == nullptr);
+    assert(sm.is_valid(false));
+  }
+  assert(resource.allocated == 0);
+}
+
+void test_huge_pages()
+{
+  Sm::Huge_page_memory_resource resource;
+  Sm sm;
+  sm.set_memory_resource(&resource);
+  CGAL::make_grid(400, 400, sm);
+  assert(sm.is_valid(false));
+  assert(sm.num_faces() == 400 * 400);
+
+  Sm copy = sm;
+  copy.collect_garbage();
+  assert(copy.is_valid(false));
+}
+
+int main()
+{
+  test_counting();
+  test_huge_pages();
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
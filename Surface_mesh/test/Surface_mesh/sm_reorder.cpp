@@ -0,0 +1,163 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh/reorder.h>
+
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>     K;
+typedef K::Point_3                         Point_3;
+typedef CGAL::Surface_mesh<Point_3>        Sm;
+typedef Sm::Vertex_index                   Vertex_index;
+typedef Sm::Halfedge_index                 Halfedge_index;
+typedef Sm::Edge_index                     Edge_index;
+typedef Sm::Face_index                     Face_index;
+
+// attaches to each element a property computed from the geometry,
+// which must still be consistent after the reordering
+void add_properties(Sm& sm)
+{
+  auto vp = sm.add_property_map<Vertex_index, Point_3>("v:copy").first;
+  auto hp = sm.add_property_map<Halfedge_index, Point_3>("h:target").first;
+  auto ep = sm.add_property_map<Edge_index, double>("e:length").first;
+  auto fp = sm.add_property_map<Face_index, Point_3>("f:first_point").first;
+  auto fb = sm.add_property_map<Face_index, bool>("f:odd").first;
+
+  for(Vertex_index v : sm.vertices())
+    vp[v] = sm.point(v);
+  for(Halfedge_index h : sm.halfedges())
+    hp[h] = sm.point(sm.target(h));
+  for(Edge_index e : sm.edges())
+    ep[e] = CGAL::squared_distance(sm.point(sm.source(sm.halfedge(e))), sm.point(sm.target(sm.halfedge(e))));
+  for(Face_index f : sm.faces())
+  {
+    fp[f] = sm.point(sm.target(sm.halfedge(f)));
+    fb[f] = (sm.degree(f) % 2 == 1);
+  }
+}
+
+void check_properties(const Sm& sm)
+{
+  assert(sm.is_valid(false));
+  assert(!sm.has_garbage());
+
+  auto vp = sm.property_map<Vertex_index, Point_3>("v:copy").value();
+  auto hp = sm.property_map<Halfedge_index, Point_3>("h:target").value();
+  auto ep = sm.property_map<Edge_index, double>("e:length").value();
+  auto fp = sm.property_map<Face_index, Point_3>("f:first_point").value();
+  auto fb = sm.property_map<Face_index, bool>("f:odd").value();
+
+  for(Vertex_index v : sm.vertices())
+    assert(vp[v] == sm.point(v));
+  for(Halfedge_index h : sm.halfedges())
+    assert(hp[h] == sm.point(sm.target(h)));
+  for(Edge_index e : sm.edges())
+    assert(ep[e] == CGAL::squared_distance(sm.point(sm.source(sm.halfedge(e))), sm.point(sm.target(sm.halfedge(e)))));
+  for(Face_index f : sm.faces())
+  {
+    assert(fp[f] == sm.point(sm.target(sm.halfedge(f))));
+    assert(fb[f] == (sm.degree(f) % 2 == 1));
+  }
+}
+
+// a grid with holes, a dangling edge and an isolated vertex
+Sm make_mesh()
+{
+  Sm sm;
+  CGAL::make_grid(60, 40, sm);
+
+  std::vector<Face_index> to_remove;
+  for(Face_index f : sm.faces())
+    if(std::size_t(f) % 7 == 3)
+      to_remove.push_back(f);
+  for(Face_index f : to_remove)
+    CGAL::Euler::remove_face(sm.halfedge(f), sm);
+
+  Vertex_index a = sm.add_vertex(Point_3(-1, -1, 0));
+  Vertex_index b = sm.add_vertex(Point_3(-2, -1, 0));
+  Halfedge_index h = sm.add_edge(a, b);
+  sm.set_halfedge(a, sm.opposite(h));
+  sm.set_halfedge(b, h);
+  sm.set_next(h, sm.opposite(h));
+  sm.set_next(sm.opposite(h), h);
+  sm.add_vertex(Point_3(-3, -3, 0));
+  return sm;
+}
+
+template <typename Reorder>
+void test(const char* name, const Reorder& reorder)
+{
+  std::cout << "Test " << name << std::endl;
+
+  Sm sm = make_mesh();
+  assert(sm.has_garbage());
+  add_properties(sm);
+
+  const std::size_t nv = sm.number_of_vertices(), ne = sm.number_of_edges(), nf = sm.number_of_faces();
+  const int nb_borders = static_cast<int>(CGAL::halfedges(sm).size() - 2 * CGAL::faces(sm).size());
+
+  reorder(sm);
+
+  check_properties(sm);
+  assert(sm.number_of_vertices() == nv && sm.number_of_edges() == ne && sm.number_of_faces() == nf);
+  assert(sm.num_vertices() == nv && sm.num_edges() == ne && sm.num_faces() == nf);
+  assert(static_cast<int>(CGAL::halfedges(sm).size() - 2 * CGAL::faces(sm).size()) == nb_borders);
+
+  // the mesh can still be modified
+  Face_index f = *sm.faces().begin();
+  CGAL::Euler::remove_face(sm.halfedge(f), sm);
+  sm.collect_garbage();
+  assert(sm.is_valid(false));
+}
+
+int main()
+{
+  test("explicit reverse order", [](Sm& sm)
+  {
+    sm.collect_garbage();
+    std::vector<Vertex_index> vertices(sm.vertices().begin(), sm.vertices().end());
+    std::vector<Face_index> faces(sm.faces().begin(), sm.faces().end());
+    std::reverse(vertices.begin(), vertices.end());
+    std::reverse(faces.begin(), faces.end());
+    const Point_3 last_point = sm.point(vertices.front());
+    sm.reorder(vertices, std::vector<Edge_index>(), faces);
+    assert(sm.point(Vertex_index(0)) == last_point);
+  });
+
+  test("spatial sort", [](Sm& sm)
+  {
+    // the order is deterministic and does not use the default random generator
+    CGAL::Random rnd = CGAL::get_default_random();
+    CGAL::reorder_spatially(sm);
+    assert(CGAL::get_default_random().get_int(0, 1 << 30) == rnd.get_int(0, 1 << 30));
+  });
+  test("parallel spatial sort", [](Sm& sm)
+  {
+    CGAL::reorder_spatially(sm, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  });
+
+  test("breadth-first", [](Sm& sm)
+  {
+    CGAL::reorder_breadth_first(sm);
+    // neighboring faces are close in the order
+    Face_index f(0);
+    for(Halfedge_index h : sm.halfedges_around_face(sm.halfedge(f)))
+    {
+      Face_index g = sm.face(sm.opposite(h));
+      assert(g == Sm::null_face() || std::size_t(g) < 10);
+    }
+  });
+  test("parallel breadth-first", [](Sm& sm)
+  {
+    CGAL::reorder_breadth_first(sm, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  });
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
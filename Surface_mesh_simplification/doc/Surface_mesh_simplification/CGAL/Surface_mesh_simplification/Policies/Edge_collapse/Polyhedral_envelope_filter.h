@@ -12,13 +12,15 @@ if any triangle in the profile is not inside the polyhedral envelope, in this or
 
 \tparam Filter must be a model of the concept `PlacementFilter`.  It defaults to a class that does
 not filter any placement.
+\tparam ConcurrencyTag enables sequential versus parallel construction of the polyhedral envelope.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
 
 \cgalModels{PlacementFilter}
 
 \sa `Polyhedral_envelope`
 
 */
-template <typename GeomTraits, typename Filter>
+template <typename GeomTraits, typename Filter, typename ConcurrencyTag>
 class Polyhedral_envelope_filter {
 public:
 
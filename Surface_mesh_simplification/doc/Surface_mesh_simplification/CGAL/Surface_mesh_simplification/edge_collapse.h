@@ -96,6 +96,18 @@ the number of edges effectively removed.
                      However, the ordering of the priority queue is no longer strict and there is a possibility
                      that some elements that ought to have been collapsed are not actually collapsed.}
    \cgalParamNEnd
+
+  \cgalParamNBegin{concurrency_tag}
+     \cgalParamDescription{a tag indicating if the simplification should be done using one or several threads.}
+     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+     \cgalParamDefault{`CGAL::Sequential_tag`}
+     \cgalParamExtra{In parallel, edges are popped from the priority queue by batches of edges with disjoint 2-rings.
+                     The validity tests and placements of the edges of a batch, as well as the costs of the edges
+                     to update after the collapses, are computed concurrently, while the collapses themselves
+                     are performed sequentially. The collapse order is thus slightly different from the sequential one.
+                     The cost and placement policies must support concurrent calls, which is the case
+                     of all the policies provided by \cgal.}
+   \cgalParamNEnd
 \cgalNamedParamsEnd
 
 \cgalHeading{Semantics}
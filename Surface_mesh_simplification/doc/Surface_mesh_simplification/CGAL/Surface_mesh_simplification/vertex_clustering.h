@@ -0,0 +1,137 @@
+namespace CGAL {
+namespace Surface_mesh_simplification {
+
+/*!
+\ingroup PkgSurfaceMeshSimplificationRef
+
+The class `Vertex_clustering_simplifier` simplifies a set of triangles by vertex clustering:
+the vertices of the triangles lying in the same cell of a uniform grid are merged,
+and the triangles whose three vertices lie in three different cells are kept.
+
+The triangles are inserted one at a time and are not stored, so that the memory footprint
+only depends on the size of the output. Each cell accumulates the plane quadrics of the triangles
+incident to its vertices, as `GarlandHeckbert_plane_policies` does, and the merged vertex
+is placed at the point of the cell minimizing this quadric.
+
+\tparam GeomTraits a model of `Kernel` whose number type is a floating point type
+
+\note This class depends on the \ref thirdpartyEigen library.
+
+\sa `vertex_clustering_simplification()`
+*/
+template <typename GeomTraits>
+class Vertex_clustering_simplifier
+{
+public:
+  /// \name Types
+  /// @{
+
+  /// the number type
+  typedef typename GeomTraits::FT FT;
+
+  /// the point type
+  typedef typename GeomTraits::Point_3 Point_3;
+
+  /// @}
+
+  /// \name Creation
+  /// @{
+
+  /*!
+  creates a grid covering `bbox` with `grid_resolution` cubic cells along its longest side.
+  The points of the triangles inserted afterwards should lie in `bbox`; points outside
+  are assigned to the closest cell.
+
+  \pre `grid_resolution > 0`
+  */
+  Vertex_clustering_simplifier(const Bbox_3& bbox,
+                               const std::size_t grid_resolution,
+                               const GeomTraits& gt = GeomTraits());
+
+  /// @}
+
+  /// \name Operations
+  /// @{
+
+  /*!
+  adds the triangle `pqr` to the input.
+  */
+  void insert(const Point_3& p, const Point_3& q, const Point_3& r);
+
+  /*!
+  writes the simplified triangles to `triangles`, as triples of indices of points
+  written to `points`. Each triangle is written once, with the orientation of the first
+  input triangle inserted with the same three cells.
+  The output is a triangle soup, which is not necessarily a manifold mesh.
+
+  \tparam PointRange a model of `BackInsertionSequence` with value type `Point_3`
+  \tparam TriangleRange a model of `BackInsertionSequence` whose value type is itself
+                        a model of `RandomAccessContainer` of integers
+  */
+  template <typename PointRange, typename TriangleRange>
+  void extract(PointRange& points, TriangleRange& triangles) const;
+
+  /// returns the number of triangles inserted so far.
+  std::size_t number_of_input_triangles() const;
+
+  /// returns the number of grid cells containing at least one vertex.
+  std::size_t number_of_occupied_cells() const;
+
+  /// returns the number of triangles that `extract()` would write.
+  std::size_t number_of_output_triangles() const;
+
+  /// @}
+};
+
+/*!
+\ingroup PkgSurfaceMeshSimplificationRef
+
+simplifies the triangle mesh or soup stored in the file `fname` by vertex clustering,
+and writes the result as a triangle soup to `points` and `triangles`.
+
+The file is read twice, once to compute its bounding box, and once to insert its triangles
+in a `Vertex_clustering_simplifier`. Faces are never stored and polygons are triangulated
+as fans, so that files larger than the available memory can be simplified;
+only the vertex coordinates of indexed formats (OFF and PLY) are kept in memory.
+
+Supported file formats are \ref IOStreamOFF (`.off`), \ref IOStreamPLY (`.ply`),
+and \ref IOStreamSTL (`.stl`, in \ascii or binary).
+
+\tparam PointRange a model of `BackInsertionSequence` whose value type is the point type
+\tparam TriangleRange a model of `BackInsertionSequence` whose value type is itself
+                      a model of `RandomAccessContainer` of integers
+\tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+\param fname the name of the input file
+\param grid_resolution the number of grid cells along the longest side of the bounding box of the input
+\param points the points of the output
+\param triangles the triangles of the output
+\param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+\cgalNamedParamsBegin
+  \cgalParamNBegin{geom_traits}
+    \cgalParamDescription{an instance of a geometric traits class}
+    \cgalParamType{a class model of `Kernel` whose number type is a floating point type}
+    \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+  \cgalParamNEnd
+
+  \cgalParamNBegin{verbose}
+    \cgalParamDescription{whether extra information is printed when an error occurs during reading}
+    \cgalParamType{Boolean}
+    \cgalParamDefault{`false`}
+  \cgalParamNEnd
+\cgalNamedParamsEnd
+
+\returns `true` if the file could be read, `false` otherwise.
+
+\note This function depends on the \ref thirdpartyEigen library.
+*/
+template <typename PointRange, typename TriangleRange, typename NamedParameters = parameters::Default_named_parameters>
+bool vertex_clustering_simplification(const std::string& fname,
+                                      const std::size_t grid_resolution,
+                                      PointRange& points,
+                                      TriangleRange& triangles,
+                                      const NamedParameters& np = parameters::default_values());
+
+} // namespace Surface_mesh_simplification
+} // namespace CGAL
@@ -27,6 +27,11 @@
 #include <vector>
 #include <type_traits>
 
+#ifdef CGAL_HAS_THREADS
+#include <CGAL/mutex.h>
+#include <atomic>
+#endif
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 
@@ -77,6 +82,26 @@ private:
     const_cast<AABB_tree*>(m_tree_ptr)->accelerate_distance_queries();
   }
 
+  // the tree is built on first use, possibly by several threads at once
+  template <typename Profile>
+  const AABB_tree& tree(const Profile& profile) const
+  {
+#ifdef CGAL_HAS_THREADS
+    if(!m_is_tree_initialized.load(std::memory_order_acquire))
+    {
+      CGAL_SCOPED_LOCK(m_tree_mutex);
+      if(m_tree_ptr == nullptr)
+        initialize_tree(profile);
+      m_is_tree_initialized.store(true, std::memory_order_release);
+    }
+#else
+    if(m_tree_ptr == nullptr)
+      initialize_tree(profile);
+#endif
+
+    return *m_tree_ptr;
+  }
+
 public:
   Bounded_distance_placement(const FT dist,
                              const BasePlacement& placement = BasePlacement())
@@ -86,6 +111,14 @@ public:
       m_base_placement(placement)
   { }
 
+  // a copy does not share the tree, it builds its own on first use
+  Bounded_distance_placement(const Bounded_distance_placement& other)
+    :
+      m_sq_threshold_dist(other.m_sq_threshold_dist),
+      m_tree_ptr(nullptr),
+      m_base_placement(other.m_base_placement)
+  { }
+
   ~Bounded_distance_placement()
   {
     if(m_tree_ptr != nullptr)
@@ -101,15 +134,12 @@ public:
     std::optional<typename Profile::Point> op = m_base_placement(profile);
     if(op)
     {
-      if(m_tree_ptr == nullptr)
-        initialize_tree(profile);
-
-      CGAL_assertion(m_tree_ptr != nullptr);
-      CGAL_assertion(!m_tree_ptr->empty());
+      const AABB_tree& input_tree = tree(profile);
+      CGAL_assertion(!input_tree.empty());
 
       const Point& p = *op;
 
-      const Point& cp = m_tree_ptr->best_hint(p).first;
+      const Point& cp = input_tree.best_hint(p).first;
 
       // We could do better by having access to the internal kd-tree
       // and call search_any_point with a fuzzy_sphere.
@@ -118,7 +148,7 @@ public:
       // any face closer than the threshold is intersected by
       // the sphere (avoid the inclusion of the mesh into the threshold sphere)
       if(CGAL::compare_squared_distance(p, cp, m_sq_threshold_dist) != LARGER ||
-         m_tree_ptr->do_intersect(CGAL::Sphere_3<Geom_traits>(p, m_sq_threshold_dist)))
+         input_tree.do_intersect(CGAL::Sphere_3<Geom_traits>(p, m_sq_threshold_dist)))
         return op;
 
       return std::optional<Point>();
@@ -131,6 +161,10 @@ private:
   const FT m_sq_threshold_dist;
   mutable const AABB_tree* m_tree_ptr;
   mutable std::vector<Triangle> m_input_triangles;
+#ifdef CGAL_HAS_THREADS
+  mutable CGAL_MUTEX m_tree_mutex;
+  mutable std::atomic<bool> m_is_tree_initialized { false };
+#endif
 
   const BasePlacement m_base_placement;
 };
@@ -92,28 +92,19 @@ vector_to_col_3(const typename GeomTraits::Vector_3& v)
   return col;
 }
 
-template <typename TriangleMesh, typename VertexPointMap, typename GeomTraits>
+template <typename GeomTraits>
 typename GeomTraits::Vector_3
-construct_unit_normal_from_face(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
-                                const TriangleMesh& tmesh,
-                                const VertexPointMap vpm,
-                                const GeomTraits& gt)
+construct_unit_normal_from_points(const typename GeomTraits::Point_3& p,
+                                  const typename GeomTraits::Point_3& q,
+                                  const typename GeomTraits::Point_3& r,
+                                  const GeomTraits& gt)
 {
-  typedef typename boost::graph_traits<TriangleMesh>::halfedge_descriptor      halfedge_descriptor;
-  typedef typename boost::property_traits<VertexPointMap>::reference           Point_ref;
-
   typedef typename GeomTraits::FT                                              FT;
   typedef typename GeomTraits::Vector_3                                        Vector_3;
 
   auto cross_product = gt.construct_cross_product_vector_3_object();
   auto squared_length = gt.compute_squared_length_3_object();
 
-  const halfedge_descriptor h = halfedge(f, tmesh);
-
-  const Point_ref p = get(vpm, target(h, tmesh));
-  const Point_ref q = get(vpm, target(next(h, tmesh), tmesh));
-  const Point_ref r = get(vpm, source(h, tmesh));
-
   Vector_3 normal = cross_product(q - p, r - p);
 
   const FT norm = sqrt(squared_length(normal));
@@ -123,6 +114,23 @@ construct_unit_normal_from_face(typename boost::graph_traits<TriangleMesh>::face
   return normal;
 }
 
+template <typename TriangleMesh, typename VertexPointMap, typename GeomTraits>
+typename GeomTraits::Vector_3
+construct_unit_normal_from_face(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
+                                const TriangleMesh& tmesh,
+                                const VertexPointMap vpm,
+                                const GeomTraits& gt)
+{
+  typedef typename boost::graph_traits<TriangleMesh>::halfedge_descriptor      halfedge_descriptor;
+
+  const halfedge_descriptor h = halfedge(f, tmesh);
+
+  return construct_unit_normal_from_points(get(vpm, target(h, tmesh)),
+                                           get(vpm, target(next(h, tmesh), tmesh)),
+                                           get(vpm, source(h, tmesh)),
+                                           gt);
+}
+
 template <typename TriangleMesh, typename VertexPointMap, typename GeomTraits>
 typename GeomTraits::Vector_3
 construct_edge_normal(typename boost::graph_traits<TriangleMesh>::halfedge_descriptor h,
@@ -320,6 +328,18 @@ construct_classic_plane_quadric_from_edge(typename boost::graph_traits<TriangleM
   return construct_classic_plane_quadric_from_normal(normal, get(vpm, target(he, mesh)), gt);
 }
 
+template <typename GeomTraits>
+typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4
+construct_classic_plane_quadric_from_points(const typename GeomTraits::Point_3& p,
+                                            const typename GeomTraits::Point_3& q,
+                                            const typename GeomTraits::Point_3& r,
+                                            const GeomTraits& gt)
+{
+  const auto normal = construct_unit_normal_from_points(p, q, r, gt);
+
+  return construct_classic_plane_quadric_from_normal(normal, p, gt);
+}
+
 template <typename TriangleMesh, typename VertexPointMap, typename GeomTraits>
 typename GarlandHeckbert_matrix_types<GeomTraits>::Mat_4
 construct_classic_plane_quadric_from_face(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
@@ -18,11 +18,24 @@
 
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Dynamic_property_map.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <boost/scoped_array.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <type_traits>
+#include <vector>
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
@@ -91,11 +104,17 @@ template<class TM_,
          class GetPlacement_,
          class ShouldIgnore_,
          class VisitorT_,
-         bool use_relaxed_heap>
+         bool use_relaxed_heap,
+         class ConcurrencyTag_ = Sequential_tag>
 class EdgeCollapse
 {
   typedef EdgeCollapse                                                    Self;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag_, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 public:
   typedef TM_                                                             Triangle_mesh;
   typedef GeomTraits_                                                     Geom_traits;
@@ -108,6 +127,7 @@ public:
   typedef GetPlacement_                                                   Get_placement;
   typedef ShouldStop_                                                     Should_stop;
   typedef VisitorT_                                                       Visitor;
+  typedef ConcurrencyTag_                                                 Concurrency_tag;
 
   typedef Edge_profile<Triangle_mesh, Vertex_point_map, Geom_traits>      Profile;
 
@@ -221,15 +241,54 @@ public:
   const Vertex_point_map& vpm() const { return m_vpm; }
 
 private:
+  typedef std::set<halfedge_descriptor, Compare_id>                       Edge_set;
+
+  // marks the vertices in the 2-ring of an edge selected in a batch
+  typedef typename boost::property_map<Triangle_mesh,
+                                       CGAL::dynamic_vertex_property_t<std::size_t> >::type
+                                                                          Vertex_batch_map;
+
+  static constexpr bool is_parallel()
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    return std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+#else
+    return false;
+#endif
+  }
+
   void collect();
   void loop();
+  void loop_in_batches();
 
   bool is_collapse_topologically_valid(const Profile& profile);
   bool is_tetrahedron(const halfedge_descriptor h);
   bool is_open_triangle(const halfedge_descriptor h1);
   bool is_collapse_geometrically_valid(const Profile& profile, Placement_type placement);
-  void collapse(const Profile& profile, Placement_type placement);
+  vertex_descriptor collapse(const Profile& profile, Placement_type placement);
   void update_neighbors(const vertex_descriptor v_kept);
+  void collect_neighbor_edges(const vertex_descriptor v_kept, Edge_set& edges_to_update, Edge_set& edges_to_insert);
+  void update_costs(const Edge_set& edges_to_update, const Edge_set& edges_to_insert);
+  bool mark_two_ring(const halfedge_descriptor h, Vertex_batch_map& batch_map, const std::size_t batch_id) const;
+
+  template <typename Functor>
+  void for_each_index(const std::size_t n, const Functor& f) const
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(is_parallel())
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i = r.begin(); i != r.end(); ++i)
+                            f(i);
+                        });
+      return;
+    }
+#endif
+    for(std::size_t i = 0; i < n; ++i)
+      f(i);
+  }
 
   Profile create_profile(const halfedge_descriptor h) {
     return Profile(h, m_tm, m_traits, m_vim, m_vpm, m_him, m_has_border);
@@ -403,8 +462,8 @@ private:
   CGAL_SMS_DEBUG_CODE(unsigned m_step;)
 };
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 EdgeCollapse(Triangle_mesh& tmesh,
              const Geom_traits& traits,
              const Should_stop& should_stop,
@@ -445,9 +504,9 @@ EdgeCollapse(Triangle_mesh& tmesh,
 #endif
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 int
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 run()
 {
   CGAL_expensive_precondition(is_valid_polygon_mesh(m_tm) && CGAL::is_triangle_mesh(m_tm));
@@ -461,7 +520,10 @@ run()
   collect();
 
   // Then proceed to collapse each edge in turn
-  loop();
+  if(is_parallel())
+    loop_in_batches();
+  else
+    loop();
 
   CGAL_SMS_TRACE(0, "Finished: " << (m_initial_edge_count - m_current_edge_count) << " edges removed.");
 
@@ -472,9 +534,9 @@ run()
   return r;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collect()
 {
   CGAL_SMS_TRACE(0, "collecting edges...");
@@ -492,6 +554,25 @@ collect()
 
   std::set<halfedge_descriptor> zero_length_edges;
 
+  // In parallel, the costs of the edges that will be inserted in the PQ are computed beforehand
+  if(is_parallel())
+  {
+    std::vector<halfedge_descriptor> candidates;
+    candidates.reserve(m_initial_edge_count);
+    for(edge_descriptor e : edges(m_tm))
+    {
+      const halfedge_descriptor h = halfedge(e, m_tm);
+      if(!is_constrained(h) &&
+         !m_traits.equal_3_object()(get_point(source(h, m_tm)), get_point(target(h, m_tm))))
+        candidates.push_back(h);
+    }
+
+    for_each_index(candidates.size(), [&](const std::size_t i)
+    {
+      get_data(candidates[i]).cost() = cost(create_profile(candidates[i]));
+    });
+  }
+
   for(edge_descriptor e : edges(m_tm))
   {
     const halfedge_descriptor h = halfedge(e, m_tm);
@@ -507,7 +588,8 @@ collect()
     {
       Edge_data& data = get_data(h);
 
-      data.cost() = cost(profile);
+      if(!is_parallel())
+        data.cost() = cost(profile);
       insert_in_PQ(h, data);
 
       m_visitor.OnCollected(profile, data.cost());
@@ -581,9 +663,9 @@ collect()
   CGAL_SMS_TRACE(0, "Initial edge count: " << m_initial_edge_count);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 loop()
 {
   CGAL_SMS_TRACE(0, "Collapsing edges...");
@@ -631,7 +713,7 @@ loop()
                                        << " " << get(m_vpm, target(*h, m_tm)) << "\n";
 #endif
           if(m_should_ignore(profile, placement)!= std::nullopt){
-            collapse(profile, placement);
+            update_neighbors(collapse(profile, placement));
           }
           else
           {
@@ -670,9 +752,192 @@ loop()
   }
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+// Parallel version of `loop()`.
+// Edges are popped from the PQ by batches of edges whose 2-rings are pairwise disjoint.
+// The collapse of an edge of a batch then does not modify the part of the mesh
+// on which the validity and the placement of the other edges of the batch depend,
+// so these can be computed concurrently. The collapses are performed sequentially
+// in the order of the PQ, then the costs of the edges around all the vertices kept
+// are updated concurrently.
+// Popped edges whose 2-ring intersects the 2-ring of an edge of the batch are put back in the PQ.
+// Because the costs are only updated at the end of a batch, the collapse order differs slightly
+// from the one of `loop()`: the batches are kept small with respect to the number of edges.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+loop_in_batches()
+{
+  CGAL_SMS_TRACE(0, "Collapsing edges by batches...");
+
+  enum Collapse_status { TOPOLOGICALLY_INVALID, GEOMETRICALLY_INVALID, VALID };
+
+  Vertex_batch_map batch_map = get(CGAL::dynamic_vertex_property_t<std::size_t>(), m_tm);
+  for(vertex_descriptor v : vertices(m_tm))
+    put(batch_map, v, 0);
+  std::size_t batch_id = 0;
+
+  std::vector<halfedge_descriptor> batch, skipped;
+  std::vector<std::optional<Profile> > profiles;
+  std::vector<Placement_type> placements;
+  std::vector<Collapse_status> status;
+  std::vector<vertex_descriptor> kept_vertices;
+
+  for(;;)
+  {
+    // (A) select a batch of edges with disjoint 2-rings, in the PQ order
+    const std::size_t batch_size = (std::min)((std::max)(std::size_t(m_current_edge_count / 256), std::size_t(1)),
+                                              std::size_t(16384));
+    ++batch_id;
+    batch.clear();
+    skipped.clear();
+
+    bool is_PQ_empty = false;
+    std::size_t nb_popped = 0;
+    while(batch.size() < batch_size && nb_popped < 2 * batch_size)
+    {
+      std::optional<halfedge_descriptor> opt_h = pop_from_PQ();
+      if(!opt_h)
+      {
+        is_PQ_empty = true;
+        break;
+      }
+
+      ++nb_popped;
+      CGAL_SMS_TRACE(1, "Popped " << edge_to_string(*opt_h));
+      CGAL_assertion(!is_constrained(*opt_h));
+
+      if(!get_data(*opt_h).cost())
+      {
+        m_visitor.OnSelected(create_profile(*opt_h), get_data(*opt_h).cost(), m_initial_edge_count, m_current_edge_count);
+        CGAL_SMS_TRACE(1, edge_to_string(*opt_h) << " uncomputable cost." );
+        continue;
+      }
+
+      if(mark_two_ring(*opt_h, batch_map, batch_id))
+        batch.push_back(*opt_h);
+      else
+        skipped.push_back(*opt_h);
+    }
+
+    // put back the edges that conflict with the batch (some might be removed by the collapses)
+    for(halfedge_descriptor h : skipped)
+      insert_in_PQ(h, get_data(h));
+
+    if(batch.empty())
+    {
+      if(is_PQ_empty)
+        break;
+      continue;
+    }
+
+    // (B) test the collapses and compute the placements concurrently
+    profiles.clear();
+    profiles.resize(batch.size());
+    placements.assign(batch.size(), std::nullopt);
+    status.assign(batch.size(), TOPOLOGICALLY_INVALID);
+
+    for_each_index(batch.size(), [&](const std::size_t i)
+    {
+      profiles[i].emplace(create_profile(batch[i]));
+      const Profile& profile = *profiles[i];
+      if(!is_collapse_topologically_valid(profile))
+        return;
+
+      placements[i] = get_placement(profile);
+      status[i] = is_collapse_geometrically_valid(profile, placements[i]) ? VALID : GEOMETRICALLY_INVALID;
+    });
+
+    // (C) collapse sequentially
+    kept_vertices.clear();
+    bool stop = false;
+    for(std::size_t i = 0; i < batch.size(); ++i)
+    {
+      const Profile& profile = *profiles[i];
+      Cost_type cost = get_data(batch[i]).cost();
+
+      m_visitor.OnSelected(profile, cost, m_initial_edge_count, m_current_edge_count);
+
+      if(m_should_stop(*cost, profile, m_initial_edge_count, m_current_edge_count))
+      {
+        m_visitor.OnStopConditionReached(profile);
+
+        CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                            << " current edge count=" << m_current_edge_count
+                            << " current edge: " << edge_to_string(batch[i]));
+        stop = true;
+        break;
+      }
+
+      if(status[i] == TOPOLOGICALLY_INVALID)
+      {
+        m_visitor.OnNonCollapsable(profile);
+
+        CGAL_SMS_TRACE(1, edge_to_string(batch[i]) << " NOT Collapsible" );
+      }
+      else if(status[i] == VALID)
+      {
+        if(m_should_ignore(profile, placements[i]) != std::nullopt)
+        {
+          kept_vertices.push_back(collapse(profile, placements[i]));
+        }
+        else
+        {
+          m_visitor.OnNonCollapsable(profile);
+
+          CGAL_SMS_TRACE(1, edge_to_string(batch[i]) << " NOT Collapsible" );
+        }
+      }
+    }
+
+    if(stop)
+      break;
+
+    // (D) update the costs of the edges around the vertices kept
+    Edge_set edges_to_update(Compare_id(this));
+    Edge_set edges_to_insert(Compare_id(this));
+    for(vertex_descriptor v : kept_vertices)
+      collect_neighbor_edges(v, edges_to_update, edges_to_insert);
+
+    update_costs(edges_to_update, edges_to_insert);
+  }
+}
+
+// Marks the vertices of the 2-ring of the edge `h` with `batch_id`.
+// Returns `false` and marks nothing if one of these vertices is already marked.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+bool
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+mark_two_ring(const halfedge_descriptor h,
+              Vertex_batch_map& batch_map,
+              const std::size_t batch_id) const
+{
+  std::vector<vertex_descriptor> two_ring;
+  for(vertex_descriptor v : { source(h, m_tm), target(h, m_tm) })
+  {
+    for(halfedge_descriptor h1 : halfedges_around_target(v, m_tm))
+    {
+      const vertex_descriptor v1 = source(h1, m_tm);
+      if(get(batch_map, v1) == batch_id)
+        return false;
+      for(halfedge_descriptor h2 : halfedges_around_target(v1, m_tm))
+      {
+        if(get(batch_map, source(h2, m_tm)) == batch_id)
+          return false;
+        two_ring.push_back(source(h2, m_tm));
+      }
+      two_ring.push_back(v1);
+    }
+  }
+
+  for(vertex_descriptor v : two_ring)
+    put(batch_map, v, batch_id);
+
+  return true;
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_border_or_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -684,9 +949,9 @@ is_border_or_constrained(const vertex_descriptor v) const
   return false;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -705,9 +970,9 @@ is_constrained(const vertex_descriptor v) const
 // The link condition is as follows: for every vertex 'k' adjacent to both 'p and 'q',
 // "p,k,q" is a facet of the mesh.
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_topologically_valid(const Profile& profile)
 {
   bool res = true;
@@ -873,17 +1138,17 @@ is_collapse_topologically_valid(const Profile& profile)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_tetrahedron(const halfedge_descriptor h)
 {
   return CGAL::is_tetrahedron(h, m_tm);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_open_triangle(const halfedge_descriptor h1)
 {
   bool res = false;
@@ -912,9 +1177,9 @@ is_open_triangle(const halfedge_descriptor h1)
 // respective areas is no greater than a max value and the internal
 // dihedral angle formed by their supporting planes is no greater than
 // a given threshold
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, const Point& p3) const
 {
   bool res = false;
@@ -964,9 +1229,9 @@ are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, co
 }
 
 // Returns the directed halfedge connecting v0 to v1, if exists.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::halfedge_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::halfedge_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_connection(const vertex_descriptor v0,
                 const vertex_descriptor v1) const
 {
@@ -981,9 +1246,9 @@ find_connection(const vertex_descriptor v0,
 
 // Given the edge 'e' around the link for the collapsinge edge "v0-v1", finds the vertex that makes a triangle adjacent to 'e' but exterior to the link (i.e not containing v0 nor v1)
 // If 'e' is a null handle OR 'e' is a border edge, there is no such triangle and a null handle is returned.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::vertex_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
                                        const vertex_descriptor v0,
                                        const vertex_descriptor v1) const
@@ -1017,9 +1282,9 @@ find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
 // A collapse is geometrically valid if, in the resulting local mesh no two adjacent triangles form an internal dihedral angle
 // greater than a fixed threshold (i.e. triangles do not "fold" into each other)
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
 {
   bool res = false;
@@ -1116,9 +1381,9 @@ is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collapse(const Profile& profile,
          Placement_type placement)
 {
@@ -1214,24 +1479,34 @@ collapse(const Profile& profile,
   m_visitor.OnCollapsed(profile, v_res);
   internal::After_collapse_oracles_updater<Self>(*this)(profile, v_res);
 
-  update_neighbors(v_res);
-
   CGAL_SMS_DEBUG_CODE(++m_step;)
+
+  return v_res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 update_neighbors(const vertex_descriptor v_kept)
 {
   CGAL_SMS_TRACE(3,"Updating cost of neighboring edges...");
 
-  // (A) collect all edges to update their cost: all those around each vertex adjacent to the vertex kept
-  typedef std::set<halfedge_descriptor, Compare_id>                       Edge_set;
-
   Edge_set edges_to_update(Compare_id(this));
   Edge_set edges_to_insert(Compare_id(this));
 
+  collect_neighbor_edges(v_kept, edges_to_update, edges_to_insert);
+  update_costs(edges_to_update, edges_to_insert);
+}
+
+// Collects all edges whose cost must be updated after a collapse:
+// all those around each vertex adjacent to the vertex kept
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+collect_neighbor_edges(const vertex_descriptor v_kept,
+                       Edge_set& edges_to_update,
+                       Edge_set& edges_to_insert)
+{
   // (A.1) loop around all vertices adjacent to the vertex kept
   for(halfedge_descriptor h : halfedges_around_target(v_kept, m_tm))
   {
@@ -1252,17 +1527,31 @@ update_neighbors(const vertex_descriptor v_kept)
         edges_to_insert.insert(h2);
     }
   }
+}
 
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+update_costs(const Edge_set& edges_to_update,
+             const Edge_set& edges_to_insert)
+{
   // (B) Proceed to update the costs.
-  for(halfedge_descriptor h : edges_to_update)
+  // The costs only depend on the mesh, so they can be computed before updating the PQ
+  std::vector<halfedge_descriptor> edges_to_compute(edges_to_update.begin(), edges_to_update.end());
+  for(halfedge_descriptor h : edges_to_insert)
+    if(!is_constrained(h)) //do not insert constrained edges
+      edges_to_compute.push_back(h);
+
+  for_each_index(edges_to_compute.size(), [&](const std::size_t i)
   {
-    Edge_data& data = get_data(h);
-    const Profile& profile = create_profile(h);
-    data.cost() = cost(profile);
+    const Profile& profile = create_profile(edges_to_compute[i]);
+    get_data(edges_to_compute[i]).cost() = cost(profile);
+  });
 
+  for(halfedge_descriptor h : edges_to_update)
+  {
     CGAL_SMS_TRACE(3, edge_to_string(h) << " updated in the PQ");
-
-    update_in_PQ(h, data);
+    update_in_PQ(h, get_data(h));
   }
 
   // (C) Insert ignored edges
@@ -1275,12 +1564,8 @@ update_neighbors(const vertex_descriptor v_kept)
     if(is_constrained(h))
       continue; //do not insert constrained edges
 
-    Edge_data& data = get_data(h);
-    const Profile& profile = create_profile(h);
-    data.cost() = cost(profile);
-
     CGAL_SMS_TRACE(3, edge_to_string(h) << " re-inserted in the PQ");
-    insert_in_PQ(h, data);
+    insert_in_PQ(h, get_data(h));
   }
 }
 
@@ -0,0 +1,568 @@
+// Copyright (c) 2026  GeometryFactory (France). All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_SURFACE_MESH_SIMPLIFICATION_VERTEX_CLUSTERING_H
+#define CGAL_SURFACE_MESH_SIMPLIFICATION_VERTEX_CLUSTERING_H
+
+#include <CGAL/license/Surface_mesh_simplification.h>
+
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/internal/GarlandHeckbert_policy_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/internal/GarlandHeckbert_functions.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Container_helper.h>
+#include <CGAL/IO/helpers.h>
+#include <CGAL/IO/OFF/File_scanner_OFF.h>
+#include <CGAL/IO/PLY/PLY_reader.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <boost/range/value_type.hpp>
+
+#include <Eigen/SVD>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Surface_mesh_simplification {
+
+// Simplification by vertex clustering (Lindstrom, "Out-of-core simplification of large
+// polygonal models", 2000): the bounding box is divided into a uniform grid of cubic cells,
+// all the vertices falling in the same cell are merged, and the triangles whose three vertices
+// fall in three different cells are kept. Each cell accumulates the plane quadrics
+// of the triangles incident to its vertices, as the Garland-Heckbert plane policies do,
+// and the merged vertex is placed at the point minimizing this quadric.
+//
+// The triangles are processed one at a time and are not stored: the memory footprint
+// depends only on the size of the simplified mesh.
+template <typename GeomTraits>
+class Vertex_clustering_simplifier
+{
+public:
+  typedef GeomTraits                                                           Geom_traits;
+  typedef typename GeomTraits::FT                                              FT;
+  typedef typename GeomTraits::Point_3                                         Point_3;
+
+private:
+  typedef internal::GarlandHeckbert_matrix_types<GeomTraits>                   Matrix_types;
+  typedef typename Matrix_types::Mat_3                                         Mat_3;
+  typedef typename Matrix_types::Col_3                                         Col_3;
+  typedef typename Matrix_types::Mat_4                                         Mat_4;
+
+  struct Cell
+  {
+    Cell() : quadric(Mat_4::Zero()), sum(Col_3::Zero()), nb_samples(0) { }
+
+    Mat_4 quadric;
+    Col_3 sum;
+    std::size_t nb_samples;
+  };
+
+  typedef std::array<std::size_t, 3>                                           Cell_triangle;
+
+  struct Cell_triangle_hash
+  {
+    std::size_t operator()(const Cell_triangle& t) const
+    {
+      std::size_t seed = 0;
+      for(std::size_t c : t)
+        seed ^= std::hash<std::size_t>()(c) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+  };
+
+  GeomTraits m_gt;
+  double m_origin[3];
+  double m_cell_size;
+  std::size_t m_dimensions[3];
+
+  std::unordered_map<std::size_t, Cell> m_cells;
+  // sorted cell triple -> cell triple in the orientation of the first triangle met
+  std::unordered_map<Cell_triangle, Cell_triangle, Cell_triangle_hash> m_triangles;
+  std::size_t m_nb_input_triangles;
+
+public:
+  // `grid_resolution` is the number of cells along the longest side of `bbox`.
+  // The points of the triangles inserted afterwards are expected to be in `bbox`,
+  // points outside are clamped to the closest cell.
+  Vertex_clustering_simplifier(const Bbox_3& bbox,
+                               const std::size_t grid_resolution,
+                               const GeomTraits& gt = GeomTraits())
+    : m_gt(gt), m_nb_input_triangles(0)
+  {
+    CGAL_precondition(grid_resolution > 0);
+
+    const double extent = (std::max)((std::max)(bbox.x_span(), bbox.y_span()), bbox.z_span());
+    m_cell_size = (extent > 0) ? extent / double(grid_resolution) : 1.;
+    for(int d=0; d<3; ++d)
+    {
+      m_origin[d] = (bbox.min)(d);
+      const double span = (bbox.max)(d) - (bbox.min)(d);
+      m_dimensions[d] = (std::max)(std::size_t(1), std::size_t(std::ceil(span / m_cell_size)));
+    }
+  }
+
+  std::size_t number_of_input_triangles() const { return m_nb_input_triangles; }
+  std::size_t number_of_occupied_cells() const { return m_cells.size(); }
+  std::size_t number_of_output_triangles() const { return m_triangles.size(); }
+
+  void insert(const Point_3& p, const Point_3& q, const Point_3& r)
+  {
+    ++m_nb_input_triangles;
+
+    const Mat_4 quadric = internal::construct_classic_plane_quadric_from_points(p, q, r, m_gt);
+
+    const Point_3* points[3] = { &p, &q, &r };
+    Cell_triangle t;
+    for(int i=0; i<3; ++i)
+    {
+      const Col_3 c = to_col(*points[i]);
+      t[i] = cell_index(c);
+
+      Cell& cell = m_cells[t[i]];
+      cell.quadric += quadric;
+      cell.sum += c;
+      ++cell.nb_samples;
+    }
+
+    // the triangle collapses to a point or to an edge
+    if(t[0] == t[1] || t[1] == t[2] || t[2] == t[0])
+      return;
+
+    Cell_triangle key = t;
+    std::sort(key.begin(), key.end());
+    m_triangles.emplace(key, t);
+  }
+
+  // Writes the simplified mesh as a triangle soup: `points` receives one point per cell
+  // that is a vertex of an output triangle, and `triangles` the indices of the three points
+  // of each triangle in `points`. The soup is not necessarily a manifold mesh.
+  template <typename PointRange, typename TriangleRange>
+  void extract(PointRange& points, TriangleRange& triangles) const
+  {
+    typedef typename boost::range_value<TriangleRange>::type                   Triangle;
+
+    std::unordered_map<std::size_t, std::size_t> output_indices;
+    auto output_index = [&](const std::size_t ci) -> std::size_t
+    {
+      auto res = output_indices.emplace(ci, points.size());
+      if(res.second)
+        points.push_back(representative(ci));
+      return res.first->second;
+    };
+
+    for(const auto& kt : m_triangles)
+    {
+      Triangle triangle;
+      CGAL::internal::resize(triangle, 3);
+      for(int i=0; i<3; ++i)
+        triangle[i] = output_index(kt.second[i]);
+      triangles.push_back(triangle);
+    }
+  }
+
+private:
+  static Col_3 to_col(const Point_3& p)
+  {
+    return Col_3(p.x(), p.y(), p.z());
+  }
+
+  void grid_coordinates(const Col_3& c, std::size_t g[3]) const
+  {
+    for(int d=0; d<3; ++d)
+    {
+      const double x = (to_double(c(d)) - m_origin[d]) / m_cell_size;
+      g[d] = (x > 0) ? (std::min)(std::size_t(x), m_dimensions[d] - 1) : 0;
+    }
+  }
+
+  std::size_t cell_index(const Col_3& c) const
+  {
+    std::size_t g[3];
+    grid_coordinates(c, g);
+    return g[0] + m_dimensions[0] * (g[1] + m_dimensions[1] * g[2]);
+  }
+
+  // the minimizer of the quadric of the cell; the directions in which the quadric
+  // is (almost) flat are resolved by staying as close as possible to the centroid
+  // of the samples, and the result is clamped to the cell
+  Point_3 representative(const std::size_t ci) const
+  {
+    const Cell& cell = m_cells.at(ci);
+    const Col_3 centroid = cell.sum / FT(cell.nb_samples);
+
+    const Mat_3 a = cell.quadric.template block<3, 3>(0, 0);
+    const Col_3 b = cell.quadric.template block<3, 1>(0, 3);
+
+    Eigen::JacobiSVD<Mat_3> svd(a, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    svd.setThreshold(1e-3);
+    Col_3 x = centroid + svd.solve(- b - a * centroid);
+
+    const std::size_t g[3] = { ci % m_dimensions[0],
+                               (ci / m_dimensions[0]) % m_dimensions[1],
+                               ci / (m_dimensions[0] * m_dimensions[1]) };
+    for(int d=0; d<3; ++d)
+    {
+      const FT lo = m_origin[d] + double(g[d]) * m_cell_size;
+      const FT hi = lo + m_cell_size;
+      if(!(x(d) >= lo)) // also catches NaN
+        x(d) = (centroid(d) < lo) ? centroid(d) : lo;
+      else if(x(d) > hi)
+        x(d) = (centroid(d) > hi) ? centroid(d) : hi;
+    }
+
+    return m_gt.construct_point_3_object()(x(0), x(1), x(2));
+  }
+};
+
+namespace internal {
+
+// The readers below call `visitor(p, q, r)` for each triangle of a file, polygons being
+// triangulated as fans. Faces are never stored; indexed formats (OFF, PLY) require
+// the vertex coordinates to be kept in memory, while STL files are fully streamed.
+
+template <typename Point_3, typename TriangleVisitor>
+void visit_polygon(const std::vector<Point_3>& vertices,
+                   const std::vector<std::size_t>& polygon,
+                   TriangleVisitor& visitor)
+{
+  for(std::size_t i=2; i<polygon.size(); ++i)
+    visitor(vertices[polygon[0]], vertices[polygon[i-1]], vertices[polygon[i]]);
+}
+
+template <typename GeomTraits, typename TriangleVisitor>
+bool stream_OFF_triangles(const std::string& fname,
+                          TriangleVisitor& visitor,
+                          const GeomTraits& gt,
+                          const bool verbose)
+{
+  typedef typename GeomTraits::Point_3                                         Point_3;
+
+  std::ifstream is(fname);
+  if(!is.good())
+  {
+    if(verbose)
+      std::cerr << "Error: cannot open " << fname << std::endl;
+    return false;
+  }
+
+  CGAL::File_scanner_OFF scanner(is, verbose);
+  if(is.fail())
+    return false;
+
+  std::vector<Point_3> vertices;
+  vertices.reserve(scanner.size_of_vertices());
+  for(std::size_t i=0; i<scanner.size_of_vertices(); ++i)
+  {
+    double x(0), y(0), z(0), w(1);
+    scanner.scan_vertex(x, y, z, w);
+    scanner.skip_to_next_vertex(i);
+    if(!is.good() || w == 0)
+      return false;
+    vertices.push_back(gt.construct_point_3_object()(x/w, y/w, z/w));
+  }
+
+  std::vector<std::size_t> polygon;
+  for(std::size_t i=0; i<scanner.size_of_facets(); ++i)
+  {
+    std::size_t no(-1);
+    scanner.scan_facet(no, i);
+    if((!is.eof() && !is.good()) || no == std::size_t(-1))
+      return false;
+
+    polygon.resize(no);
+    for(std::size_t j=0; j<no; ++j)
+    {
+      scanner.scan_facet_vertex_index(polygon[j], j+1, i);
+      if(!is || polygon[j] >= vertices.size())
+        return false;
+    }
+    scanner.skip_to_next_facet(i);
+
+    visit_polygon(vertices, polygon, visitor);
+  }
+
+  return !is.fail();
+}
+
+template <typename GeomTraits, typename TriangleVisitor>
+bool stream_PLY_triangles(const std::string& fname,
+                          TriangleVisitor& visitor,
+                          const GeomTraits& gt,
+                          const bool verbose)
+{
+  typedef typename GeomTraits::Point_3                                         Point_3;
+
+  std::ifstream is(fname, std::ios::binary);
+  if(!is.good())
+  {
+    if(verbose)
+      std::cerr << "Error: cannot open " << fname << std::endl;
+    return false;
+  }
+
+  IO::internal::PLY_reader reader(verbose);
+  if(!reader.init(is))
+    return false;
+
+  std::vector<Point_3> vertices;
+  std::vector<std::size_t> polygon;
+
+  auto read_item = [&is](IO::internal::PLY_element& element) -> bool
+  {
+    for(std::size_t k=0; k<element.number_of_properties(); ++k)
+    {
+      element.property(k)->get(is);
+      if(is.fail())
+        return false;
+    }
+    return true;
+  };
+
+  auto stream_faces = [&](IO::internal::PLY_element& element, auto index, const char* tag) -> bool
+  {
+    std::vector<decltype(index)> indices;
+    for(std::size_t j=0; j<element.number_of_items(); ++j)
+    {
+      if(!read_item(element))
+        return false;
+
+      element.assign(indices, tag);
+      polygon.clear();
+      for(auto id : indices)
+      {
+        if(id < 0 || std::size_t(id) >= vertices.size())
+          return false;
+        polygon.push_back(std::size_t(id));
+      }
+
+      visit_polygon(vertices, polygon, visitor);
+    }
+    return true;
+  };
+
+  for(std::size_t i=0; i<reader.number_of_elements(); ++i)
+  {
+    IO::internal::PLY_element& element = reader.element(i);
+
+    if(element.name() == "vertex" || element.name() == "vertices")
+    {
+      vertices.reserve(element.number_of_items());
+      for(std::size_t j=0; j<element.number_of_items(); ++j)
+      {
+        if(!read_item(element))
+          return false;
+
+        double x(0), y(0), z(0);
+        element.assign(x, "x");
+        element.assign(y, "y");
+        element.assign(z, "z");
+        vertices.push_back(gt.construct_point_3_object()(x, y, z));
+      }
+    }
+    else if(element.name() == "face" || element.name() == "faces")
+    {
+      bool ok = false;
+      if(element.has_property<std::vector<std::int32_t> >("vertex_indices"))
+        ok = stream_faces(element, std::int32_t(), "vertex_indices");
+      else if(element.has_property<std::vector<std::uint32_t> >("vertex_indices"))
+        ok = stream_faces(element, std::uint32_t(), "vertex_indices");
+      else if(element.has_property<std::vector<std::int32_t> >("vertex_index"))
+        ok = stream_faces(element, std::int32_t(), "vertex_index");
+      else if(element.has_property<std::vector<std::uint32_t> >("vertex_index"))
+        ok = stream_faces(element, std::uint32_t(), "vertex_index");
+      else if(verbose)
+        std::cerr << "Error: can't find vertex indices in PLY input" << std::endl;
+
+      if(!ok)
+        return false;
+    }
+    else // ignore other elements
+    {
+      for(std::size_t j=0; j<element.number_of_items(); ++j)
+        if(!read_item(element))
+          return false;
+    }
+  }
+
+  return !is.fail();
+}
+
+template <typename GeomTraits, typename TriangleVisitor>
+bool stream_STL_triangles(const std::string& fname,
+                          TriangleVisitor& visitor,
+                          const GeomTraits& gt,
+                          const bool verbose)
+{
+  typedef typename GeomTraits::Point_3                                         Point_3;
+
+  std::ifstream is(fname, std::ios::binary);
+  if(!is.good())
+  {
+    if(verbose)
+      std::cerr << "Error: cannot open " << fname << std::endl;
+    return false;
+  }
+
+  // binary files are recognized from their size, as some of them start with 'solid'
+  is.seekg(0, std::ios::end);
+  const std::streamoff file_size = is.tellg();
+  is.seekg(0, std::ios::beg);
+
+  std::uint32_t nb_facets = 0;
+  if(file_size >= 84)
+  {
+    is.seekg(80, std::ios::beg);
+    is.read(reinterpret_cast<char*>(&nb_facets), sizeof(nb_facets));
+  }
+
+  if(file_size >= 84 && file_size == 84 + 50 * std::streamoff(nb_facets))
+  {
+    for(std::uint32_t i=0; i<nb_facets; ++i)
+    {
+      float data[12]; // normal, then the three points
+      char attribute[2];
+      if(!is.read(reinterpret_cast<char*>(data), sizeof(data)) || !is.read(attribute, 2))
+        return false;
+
+      Point_3 points[3];
+      for(int j=0; j<3; ++j)
+        points[j] = gt.construct_point_3_object()(data[3*j+3], data[3*j+4], data[3*j+5]);
+      visitor(points[0], points[1], points[2]);
+    }
+    return true;
+  }
+
+  is.clear();
+  is.seekg(0, std::ios::beg);
+
+  std::string s;
+  Point_3 points[3];
+  int count = 0;
+  while(is >> s)
+  {
+    if(s == "facet")
+    {
+      count = 0;
+    }
+    else if(s == "vertex")
+    {
+      double x, y, z;
+      if(count >= 3 || !(is >> IO::iformat(x) >> IO::iformat(y) >> IO::iformat(z)))
+      {
+        if(verbose)
+          std::cerr << "Error while reading STL facet" << std::endl;
+        return false;
+      }
+      points[count++] = gt.construct_point_3_object()(x, y, z);
+    }
+    else if(s == "endfacet")
+    {
+      if(count != 3)
+      {
+        if(verbose)
+          std::cerr << "Error: only triangulated surfaces are supported" << std::endl;
+        return false;
+      }
+      visitor(points[0], points[1], points[2]);
+    }
+  }
+
+  return is.eof();
+}
+
+template <typename GeomTraits, typename TriangleVisitor>
+bool stream_triangles(const std::string& fname,
+                      TriangleVisitor& visitor,
+                      const GeomTraits& gt,
+                      const bool verbose)
+{
+  const std::string ext = IO::internal::get_file_extension(fname);
+
+  if(ext == "off")
+    return stream_OFF_triangles(fname, visitor, gt, verbose);
+  else if(ext == "ply")
+    return stream_PLY_triangles(fname, visitor, gt, verbose);
+  else if(ext == "stl")
+    return stream_STL_triangles(fname, visitor, gt, verbose);
+
+  if(verbose)
+    std::cerr << "Error: unsupported file format for streaming: " << ext << std::endl;
+  return false;
+}
+
+} // namespace internal
+
+template <typename PointRange, typename TriangleRange,
+          typename NamedParameters = parameters::Default_named_parameters>
+bool vertex_clustering_simplification(const std::string& fname,
+                                      const std::size_t grid_resolution,
+                                      PointRange& points,
+                                      TriangleRange& triangles,
+                                      const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename boost::range_value<PointRange>::type                        Point;
+  typedef typename Kernel_traits<Point>::Kernel                                Default_GT;
+  typedef typename internal_np::Lookup_named_param_def<internal_np::geom_traits_t,
+                                                       NamedParameters,
+                                                       Default_GT>::type       Geom_traits;
+  typedef typename Geom_traits::Point_3                                        Point_3;
+
+  const Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(np, internal_np::geom_traits));
+  const bool verbose = choose_parameter(get_parameter(np, internal_np::verbose), false);
+
+  // first pass: bounding box
+  Bbox_3 bbox;
+  auto extend_bbox = [&bbox](const Point_3& p, const Point_3& q, const Point_3& r)
+  {
+    bbox += p.bbox() + q.bbox() + r.bbox();
+  };
+  if(!internal::stream_triangles(fname, extend_bbox, gt, verbose))
+    return false;
+
+  if(bbox.xmin() > bbox.xmax()) // no triangle
+    return true;
+
+  // second pass: clustering
+  Vertex_clustering_simplifier<Geom_traits> simplifier(bbox, grid_resolution, gt);
+  auto insert = [&simplifier](const Point_3& p, const Point_3& q, const Point_3& r)
+  {
+    simplifier.insert(p, q, r);
+  };
+  if(!internal::stream_triangles(fname, insert, gt, verbose))
+    return false;
+
+  if(verbose)
+    std::cout << simplifier.number_of_input_triangles() << " triangles clustered in "
+              << simplifier.number_of_occupied_cells() << " cells" << std::endl;
+
+  simplifier.extract(points, triangles);
+
+  return true;
+}
+
+} // namespace Surface_mesh_simplification
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_SIMPLIFICATION_VERTEX_CLUSTERING_H
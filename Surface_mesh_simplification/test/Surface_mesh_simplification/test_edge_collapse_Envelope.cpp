@@ -30,6 +30,9 @@ typedef CGAL::Surface_mesh<Point_3>                           Surface;
 typedef SMS::LindstromTurk_cost<Surface>                      Cost;
 typedef SMS::LindstromTurk_placement<Surface>                 Placement;
 typedef SMS::Polyhedral_envelope_filter<Kernel,SMS::Bounded_normal_change_filter<> > Filter;
+typedef SMS::Polyhedral_envelope_filter<Kernel,
+                                        SMS::Bounded_normal_change_filter<>,
+                                        CGAL::Parallel_if_available_tag> Parallel_filter;
 
 struct Stats
 {
@@ -112,6 +115,7 @@ int main(int argc, char** argv)
   Surface small_envelope_mesh = input_mesh;
   Surface big_envelope_mesh = input_mesh;
   Surface huge_envelope_mesh = input_mesh;
+  Surface parallel_envelope_mesh = input_mesh;
 
   CGAL::Timer t;
   t.start();
@@ -143,6 +147,16 @@ int main(int argc, char** argv)
     SMS::edge_collapse(huge_envelope_mesh, stop, CGAL::parameters::get_cost(Cost()).filter(filter).get_placement(placement));
     std::cout << "Output has " << vertices(huge_envelope_mesh).size() << " vertices and " << edges(huge_envelope_mesh).size() << " edges" << std::endl;
     std::cout << t.time() << "sec\n";
+    t.reset();
+  }
+
+  {
+    std::cout << "eps = " << 0.01*diag << " (parallel envelope construction)" << std::endl;
+    Placement placement;
+    Parallel_filter filter(0.01*diag);
+    SMS::edge_collapse(parallel_envelope_mesh, stop, CGAL::parameters::get_cost(Cost()).filter(filter).get_placement(placement));
+    std::cout << "Output has " << vertices(parallel_envelope_mesh).size() << " vertices and " << edges(parallel_envelope_mesh).size() << " edges" << std::endl;
+    std::cout << t.time() << "sec\n";
   }
 
 
@@ -159,6 +173,8 @@ int main(int argc, char** argv)
   assert(vertices(input_mesh).size() > vertices(small_envelope_mesh).size());
   assert(vertices(small_envelope_mesh).size() > vertices(big_envelope_mesh).size());
   assert(vertices(big_envelope_mesh).size() > vertices(huge_envelope_mesh).size());
+  // the envelope does not depend on the concurrency tag
+  assert(vertices(parallel_envelope_mesh).size() == vertices(big_envelope_mesh).size());
 
   return EXIT_SUCCESS;
 }
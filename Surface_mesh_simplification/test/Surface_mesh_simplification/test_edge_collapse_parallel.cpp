@@ -0,0 +1,116 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+// Simplification function
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Edge_collapse_visitor_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_distance_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_placement.h>
+
+//AABB_tree
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/boost/graph/helpers.h>
+
+#include <iostream>
+#include <fstream>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Simple_cartesian<double>                        Kernel;
+
+typedef Kernel::Point_3                                       Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface;
+
+typedef SMS::LindstromTurk_cost<Surface>                      Cost;
+typedef SMS::LindstromTurk_placement<Surface>                 Placement;
+
+typedef CGAL::AABB_face_graph_triangle_primitive<Surface>     Primitive;
+typedef CGAL::AABB_traits_3<Kernel, Primitive>                Traits;
+typedef CGAL::AABB_tree<Traits>                               Tree;
+
+typedef SMS::Bounded_distance_placement<Placement, Kernel>    Filtered_placement;
+
+struct Counting_visitor
+  : SMS::Edge_collapse_visitor_base<Surface>
+{
+  Counting_visitor(int& nb_collapsed) : m_nb_collapsed(nb_collapsed) { }
+
+  void OnCollapsed(const Profile&, const vertex_descriptor) { ++m_nb_collapsed; }
+
+  int& m_nb_collapsed;
+};
+
+// mean distance of the vertices of `mesh` to `tree`
+double mean_distance(const Surface& mesh, const Tree& tree)
+{
+  double sum = 0;
+  for(Surface::Vertex_index v : vertices(mesh))
+    sum += CGAL::approximate_sqrt(tree.squared_distance(mesh.point(v)));
+  return sum / double(num_vertices(mesh));
+}
+
+int main(int argc, char** argv)
+{
+  Surface input;
+  std::ifstream is(argc > 1 ? argv[1] : "data/femur.off");
+  is >> input;
+  assert(num_vertices(input) != 0);
+
+  std::cout << "input has " << edges(input).size() << " edges." << std::endl;
+
+  Tree tree(faces(input).first, faces(input).second, input);
+  tree.accelerate_distance_queries();
+
+  const std::size_t target = edges(input).size() / 10;
+  SMS::Edge_count_stop_predicate<Surface> stop(target);
+
+  Surface seq_mesh = input, par_mesh = input;
+  int seq_removed = SMS::edge_collapse(seq_mesh, stop,
+                                       CGAL::parameters::get_cost(Cost()).get_placement(Placement()));
+
+  int nb_collapsed = 0;
+  int par_removed = SMS::edge_collapse(par_mesh, stop,
+                                       CGAL::parameters::get_cost(Cost())
+                                                        .get_placement(Placement())
+                                                        .visitor(Counting_visitor(nb_collapsed))
+                                                        .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::cout << "sequential: " << edges(seq_mesh).size() << " edges left" << std::endl;
+  std::cout << "parallel: " << edges(par_mesh).size() << " edges left" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(par_mesh) && CGAL::is_triangle_mesh(par_mesh));
+  assert(edges(par_mesh).size() < target);
+  assert(edges(seq_mesh).size() == edges(par_mesh).size());
+  assert(seq_removed == par_removed);
+  assert(nb_collapsed > 0 && nb_collapsed < par_removed);
+
+  // the batches do not follow exactly the greedy order, but the quality must be close
+  const double seq_distance = mean_distance(seq_mesh, tree);
+  const double par_distance = mean_distance(par_mesh, tree);
+  std::cout << "mean distance to the input: " << seq_distance << " (sequential), "
+            << par_distance << " (parallel)" << std::endl;
+  assert(par_distance < 1.5 * seq_distance);
+
+  // the placement filter builds its tree on first use, concurrently
+  CGAL::Iso_cuboid_3<Kernel> bbox(CGAL::Polygon_mesh_processing::bbox(input));
+  const double diag = CGAL::approximate_sqrt(CGAL::squared_distance((bbox.min)(), (bbox.max)()));
+
+  Surface bounded_mesh = input;
+  Filtered_placement placement(0.00001 * diag, Placement());
+  SMS::edge_collapse(bounded_mesh, stop,
+                     CGAL::parameters::get_cost(Cost())
+                                      .get_placement(placement)
+                                      .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::cout << "bounded distance: " << edges(bounded_mesh).size() << " edges left" << std::endl;
+  assert(CGAL::is_valid_polygon_mesh(bounded_mesh) && CGAL::is_triangle_mesh(bounded_mesh));
+  assert(edges(bounded_mesh).size() > edges(par_mesh).size());
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/vertex_clustering.h>
+
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/IO/STL.h>
+
+#include <array>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Simple_cartesian<double>                        Kernel;
+typedef Kernel::Point_3                                       Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface;
+
+typedef CGAL::AABB_face_graph_triangle_primitive<Surface>     Primitive;
+typedef CGAL::AABB_traits_3<Kernel, Primitive>                Traits;
+typedef CGAL::AABB_tree<Traits>                               Tree;
+
+typedef std::array<std::size_t, 3>                            Triangle;
+
+void check_soup(const std::vector<Point_3>& points, const std::vector<Triangle>& triangles)
+{
+  for(const Triangle& t : triangles)
+  {
+    assert(t[0] != t[1] && t[1] != t[2] && t[2] != t[0]);
+    for(std::size_t i : t)
+      assert(i < points.size());
+  }
+}
+
+// the output of the file readers must be the same as the one of the in-memory simplifier
+void test_formats(const std::string& filename)
+{
+  std::cout << "Simplification of " << filename << std::endl;
+
+  std::vector<Point_3> input_points;
+  std::vector<Triangle> input_triangles;
+  bool ok = CGAL::IO::read_polygon_soup(filename, input_points, input_triangles);
+  assert(ok);
+
+  const CGAL::Bbox_3 bbox = CGAL::bbox_3(input_points.begin(), input_points.end());
+
+  const std::size_t resolution = 32;
+  SMS::Vertex_clustering_simplifier<Kernel> simplifier(bbox, resolution);
+  for(const Triangle& t : input_triangles)
+    simplifier.insert(input_points[t[0]], input_points[t[1]], input_points[t[2]]);
+
+  std::vector<Point_3> points;
+  std::vector<Triangle> triangles;
+  simplifier.extract(points, triangles);
+  check_soup(points, triangles);
+
+  std::cout << "  " << input_triangles.size() << " input triangles, "
+            << triangles.size() << " output triangles" << std::endl;
+  assert(simplifier.number_of_input_triangles() == input_triangles.size());
+  assert(!triangles.empty() && triangles.size() < input_triangles.size());
+
+  // the output vertices are close to the input surface
+  Surface sm;
+  for(const Point_3& p : input_points)
+    sm.add_vertex(p);
+  for(const Triangle& t : input_triangles)
+    sm.add_face(Surface::Vertex_index(Surface::size_type(t[0])),
+                Surface::Vertex_index(Surface::size_type(t[1])),
+                Surface::Vertex_index(Surface::size_type(t[2])));
+  Tree tree(faces(sm).first, faces(sm).second, sm);
+  const double cell_size = (std::max)((std::max)(bbox.x_span(), bbox.y_span()), bbox.z_span()) / resolution;
+  for(const Point_3& p : points)
+    assert(CGAL::approximate_sqrt(tree.squared_distance(p)) < std::sqrt(3.) * cell_size);
+
+  // streaming from the different file formats
+  const std::string ply_name = "vertex_clustering_tmp.ply";
+  const std::string stl_name = "vertex_clustering_tmp.stl";
+  const std::string ascii_stl_name = "vertex_clustering_tmp_ascii.stl";
+  ok = CGAL::IO::write_polygon_soup(ply_name, input_points, input_triangles,
+                                    CGAL::parameters::stream_precision(17).use_binary_mode(true));
+  assert(ok);
+  ok = CGAL::IO::write_STL(stl_name, input_points, input_triangles,
+                           CGAL::parameters::use_binary_mode(true));
+  assert(ok);
+  ok = CGAL::IO::write_STL(ascii_stl_name, input_points, input_triangles,
+                           CGAL::parameters::use_binary_mode(false).stream_precision(17));
+  assert(ok);
+
+  for(const std::string& name : { filename, ply_name, stl_name, ascii_stl_name })
+  {
+    std::vector<Point_3> streamed_points;
+    std::vector<Triangle> streamed_triangles;
+    ok = SMS::vertex_clustering_simplification(name, resolution, streamed_points, streamed_triangles);
+    assert(ok);
+    check_soup(streamed_points, streamed_triangles);
+    std::cout << "  " << name << ": " << streamed_triangles.size() << " output triangles" << std::endl;
+
+    // binary STL files store single precision coordinates
+    if(name == stl_name)
+      assert(std::abs(double(streamed_triangles.size()) - double(triangles.size())) < 0.02 * triangles.size());
+    else
+      assert(streamed_triangles.size() == triangles.size() && streamed_points.size() == points.size());
+  }
+
+  std::remove(ply_name.c_str());
+  std::remove(stl_name.c_str());
+  std::remove(ascii_stl_name.c_str());
+
+  assert(!SMS::vertex_clustering_simplification("does_not_exist.off", resolution, points, triangles));
+}
+
+// the representative points minimize the plane quadrics: the corners and the faces
+// of a box are preserved
+void test_box()
+{
+  std::cout << "Simplification of a box" << std::endl;
+
+  // a finely subdivided box, so that each cell contains several vertices
+  std::vector<std::array<Point_3, 3> > triangles;
+  const int n = 40;
+  for(int axis=0; axis<3; ++axis)
+    for(int side=0; side<2; ++side)
+      for(int i=0; i<n; ++i)
+        for(int j=0; j<n; ++j)
+        {
+          auto point = [&](int a, int b)
+          {
+            double c[3];
+            c[axis] = side;
+            c[(axis + 1) % 3] = double(a) / n;
+            c[(axis + 2) % 3] = double(b) / n;
+            return Point_3(c[0], c[1], c[2]);
+          };
+          triangles.push_back({ point(i, j), point(i+1, j), point(i+1, j+1) });
+          triangles.push_back({ point(i, j), point(i+1, j+1), point(i, j+1) });
+        }
+
+  SMS::Vertex_clustering_simplifier<Kernel> simplifier(CGAL::Bbox_3(-0.05, -0.05, -0.05, 1.05, 1.05, 1.05), 7);
+  for(const auto& t : triangles)
+    simplifier.insert(t[0], t[1], t[2]);
+
+  std::vector<Point_3> points;
+  std::vector<Triangle> out;
+  simplifier.extract(points, out);
+  check_soup(points, out);
+  std::cout << "  " << out.size() << " output triangles" << std::endl;
+
+  std::size_t nb_corners = 0;
+  for(const Point_3& p : points)
+  {
+    int nb_on_sides = 0;
+    for(int d=0; d<3; ++d)
+      if(std::abs(p[d]) < 1e-10 || std::abs(p[d] - 1) < 1e-10)
+        ++nb_on_sides;
+    assert(nb_on_sides >= 1);
+    if(nb_on_sides == 3)
+      ++nb_corners;
+  }
+  assert(nb_corners == 8);
+}
+
+int main(int argc, char** argv)
+{
+  test_formats(argc > 1 ? argv[1] : "data/femur.off");
+  test_box();
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -98,6 +98,28 @@ Returns a reference to the container of vertices.
 */
 Vertex_range & vertices();
 
+/*!
+Moves the vertices to new containers, in the order of the range `[first, last)`,
+and the cells next to the first of their vertices in this order.
+After many insertions and removals, this makes iterating over the vertices and cells
+faster, and releases the memory blocks of the containers that held only removed elements.
+Returns the new vertex corresponding to `v`.
+
+All handles and iterators on vertices and cells are invalidated.
+
+\tparam InputIterator must be an input iterator with value type `Vertex_handle`.
+
+\pre The range `[first, last)` contains each vertex of the data structure exactly once.
+*/
+template <class InputIterator>
+Vertex_handle compact(InputIterator first, InputIterator last,
+                      Vertex_handle v = Vertex_handle());
+
+/*!
+Same as above, keeping the current order of the vertices.
+*/
+Vertex_handle compact(Vertex_handle v = Vertex_handle());
+
 /// @}
 
 }; /* end Triangulation_data_structure_3 */
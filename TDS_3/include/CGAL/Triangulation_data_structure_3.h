@@ -1544,6 +1544,25 @@ public:
   template <class TDS_src,class ConvertVertex,class ConvertCell>
   Vertex_handle copy_tds(const TDS_src&, typename TDS_src::Vertex_handle,const ConvertVertex&,const ConvertCell&);
 
+  // Relocates the vertices into new containers in the order given by
+  // [first, last), which must contain each vertex exactly once, and the cells
+  // in the order of their first vertex. Memory blocks holding only freed
+  // elements are released. All handles and iterators are invalidated.
+  // returns the new vertex corresponding to vert
+  template <class InputIterator>
+  Vertex_handle compact(InputIterator first, InputIterator last,
+                        Vertex_handle vert = Vertex_handle());
+
+  // Same as above, keeping the current order of the vertices.
+  Vertex_handle compact(Vertex_handle vert = Vertex_handle())
+  {
+    std::vector<Vertex_handle> vertices_in_order;
+    vertices_in_order.reserve(number_of_vertices());
+    for(Vertex_iterator vit = vertices_begin(); vit != vertices_end(); ++vit)
+      vertices_in_order.push_back(vit);
+    return compact(vertices_in_order.begin(), vertices_in_order.end(), vert);
+  }
+
 
   void swap(Tds & tds);
 
@@ -4133,6 +4152,88 @@ copy_tds(const TDS_src& tds,
   return (vert != typename TDS_src::Vertex_handle()) ? V[vert] : Vertex_handle();
 }
 
+template <class Vb, class Cb, class Ct>
+template <class InputIterator>
+typename Triangulation_data_structure_3<Vb,Cb,Ct>::Vertex_handle
+Triangulation_data_structure_3<Vb,Cb,Ct>::
+compact(InputIterator first, InputIterator last, Vertex_handle vert)
+{
+  CGAL_expensive_precondition( vert == Vertex_handle() || is_vertex(vert) );
+
+  if(number_of_vertices() == 0)
+    return Vertex_handle();
+
+  // Number of pointers to cell/vertex to update per cell.
+  const int dim = (std::max)(1, dimension() + 1);
+
+  // Number of neighbors to update
+  const int nn = (std::max)(0, dimension() + 1);
+
+  Vertex_range new_vertices;
+  Cell_range new_cells;
+
+  // Create the vertices, in the requested order.
+  Unique_hash_map<Vertex_handle, size_type> V_index(size_type(-1), number_of_vertices());
+  std::vector<Vertex_handle> V;
+  V.reserve(number_of_vertices());
+  for(; first != last; ++first)
+  {
+    CGAL_precondition(!V_index.is_defined(*first));
+    V_index[*first] = V.size();
+    V.push_back(new_vertices.insert(**first));
+  }
+  CGAL_precondition(V.size() == number_of_vertices());
+
+  // Sort the cells by the smallest index of their vertices (counting sort),
+  // so that the cells incident to a vertex are close in memory.
+  std::vector<size_type> cell_keys;
+  cell_keys.reserve(number_of_cells());
+  std::vector<size_type> offsets(V.size() + 1, 0);
+  for(Cell_iterator cit = cells().begin(); cit != cells_end(); ++cit)
+  {
+    size_type key = V_index[cit->vertex(0)];
+    for(int j = 1; j < dim; ++j)
+      key = (std::min)(key, V_index[cit->vertex(j)]);
+    cell_keys.push_back(key);
+    ++offsets[key + 1];
+  }
+  for(std::size_t i = 1; i < offsets.size(); ++i)
+    offsets[i] += offsets[i-1];
+
+  std::vector<Cell_handle> sorted_cells(cell_keys.size());
+  size_type ci = 0;
+  for(Cell_iterator cit = cells().begin(); cit != cells_end(); ++cit)
+    sorted_cells[offsets[cell_keys[ci++]]++] = cit;
+
+  // Create the cells.
+  Unique_hash_map<Cell_handle, Cell_handle> F(Cell_handle(), number_of_cells());
+  for(Cell_handle c : sorted_cells)
+    F[c] = new_cells.insert(*c);
+
+  // The copies still point to the old elements: update them.
+  for(Cell_handle c : sorted_cells)
+  {
+    Cell_handle ch = F[c];
+    for(int j = 0; j < dim; ++j)
+      ch->set_vertex(j, V[V_index[c->vertex(j)]]);
+    for(int j = 0; j < nn; ++j)
+      ch->set_neighbor(j, F[c->neighbor(j)]);
+  }
+
+  for(Vertex_handle vh : V)
+    vh->set_cell(F[vh->cell()]);
+
+  const Vertex_handle new_vert = (vert != Vertex_handle()) ? V[V_index[vert]] : Vertex_handle();
+
+  // The old elements and their blocks are freed with the swapped containers.
+  cells().swap(new_cells);
+  vertices().swap(new_vertices);
+
+  CGAL_postcondition( is_valid() );
+
+  return new_vert;
+}
+
 //utilities for copy_tds
 namespace internal { namespace TDS_3{
   template <class Vertex_src,class Vertex_tgt>
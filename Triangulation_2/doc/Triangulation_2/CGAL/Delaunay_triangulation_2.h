@@ -155,6 +155,16 @@ template < class PointInputIterator >
 std::ptrdiff_t
 insert(PointInputIterator first, PointInputIterator last);
 
+/*!
+same as above, with the points spatially sorted using the strategy `policy`
+(see `spatial_sort()`).
+\tparam PointInputIterator must be an input iterator with the value type `Point`.
+\tparam PolicyTag is `Median`, `Middle`, or `Radix`.
+*/
+template < class PointInputIterator, class PolicyTag >
+std::ptrdiff_t
+insert(PointInputIterator first, PointInputIterator last, Hilbert_policy<PolicyTag> policy);
+
 /*!
 inserts the points in the iterator range `[first,last)`. Returns the number of inserted points.
 Note that this function is not guaranteed to insert the points
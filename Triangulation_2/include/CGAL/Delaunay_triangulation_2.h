@@ -311,11 +311,19 @@ public:
   std::ptrdiff_t
   insert(InputIterator first, InputIterator last)
 #endif //CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
+  {
+    return insert(first, last, Hilbert_sort_median_policy());
+  }
+
+  // same as above, with the points spatially sorted using `policy`
+  template < class InputIterator, class PolicyTag >
+  std::ptrdiff_t
+  insert(InputIterator first, InputIterator last, Hilbert_policy<PolicyTag> policy)
   {
     size_type n = this->number_of_vertices();
 
     std::vector<Point> points (first, last);
-    spatial_sort (points.begin(), points.end(), geom_traits());
+    spatial_sort<Parallel_if_available_tag> (points.begin(), points.end(), geom_traits(), policy);
     Face_handle f;
     for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
          p != end; ++p)
@@ -349,8 +357,8 @@ private:
     typedef typename Pointer_property_map<Point>::type Pmap;
     typedef Spatial_sort_traits_adapter_2<Geom_traits,Pmap> Search_traits;
 
-    spatial_sort(indices.begin(), indices.end(),
-                 Search_traits(make_property_map(points),geom_traits()));
+    spatial_sort<Parallel_if_available_tag>(indices.begin(), indices.end(),
+                                            Search_traits(make_property_map(points),geom_traits()));
 
     Vertex_handle v_hint;
     Face_handle hint;
@@ -418,10 +418,10 @@ public:
     typedef boost::function_property_map<Construct_point_2, Weighted_point, Ret> fpmap;
     typedef CGAL::Spatial_sort_traits_adapter_2<Geom_traits, fpmap> Search_traits_2;
 
-    spatial_sort(points.begin(), points.end(),
-                 Search_traits_2(
-                   boost::make_function_property_map<Weighted_point, Ret, Construct_point_2>(
-                     geom_traits().construct_point_2_object()), geom_traits()));
+    spatial_sort<Parallel_if_available_tag>(points.begin(), points.end(),
+                                            Search_traits_2(
+                                              boost::make_function_property_map<Weighted_point, Ret, Construct_point_2>(
+                                                geom_traits().construct_point_2_object()), geom_traits()));
 
     Face_handle hint;
     for(typename std::vector<Weighted_point>::const_iterator p = points.begin(),
@@ -487,11 +487,11 @@ private:
     typedef CGAL::Spatial_sort_traits_adapter_2<Gt, fpmap> Search_traits_2;
 
     Access_bare_point accessor(points, geom_traits().construct_point_2_object());
-    spatial_sort(indices.begin(), indices.end(),
-                 Search_traits_2(
-                   boost::make_function_property_map<
-                     std::size_t, Ret, Access_bare_point>(accessor),
-                   geom_traits()));
+    spatial_sort<Parallel_if_available_tag>(indices.begin(), indices.end(),
+                                            Search_traits_2(
+                                              boost::make_function_property_map<
+                                                std::size_t, Ret, Access_bare_point>(accessor),
+                                              geom_traits()));
 
     Face_handle hint;
     Vertex_handle v_hint;
@@ -0,0 +1,72 @@
+// Times the insertion of random weighted points in a regular triangulation
+// for an increasing number of threads.
+// Usage: RT3_parallel_insertion [number_of_points] [max_weight]
+// The larger `max_weight`, the more points are hidden.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <tbb/global_control.h>
+#include <tbb/info.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel        K;
+typedef K::Point_3                                                 Point;
+typedef K::Weighted_point_3                                        Weighted_point;
+
+typedef CGAL::Regular_triangulation_vertex_base_3<K>               Vb;
+typedef CGAL::Regular_triangulation_cell_base_3<K>                 Cb;
+typedef CGAL::Triangulation_data_structure_3<Vb, Cb>               Tds;
+typedef CGAL::Regular_triangulation_3<K, Tds>                      RT;
+
+typedef CGAL::Triangulation_data_structure_3<
+          Vb, Cb, CGAL::Parallel_tag>                              Tds_parallel;
+typedef CGAL::Regular_triangulation_3<K, Tds_parallel>             RT_parallel;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t nb_points = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const double max_weight = (argc > 2) ? std::atof(argv[2]) : 0.0001;
+
+  CGAL::Random rnd(0);
+  std::vector<Weighted_point> points;
+  points.reserve(nb_points);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+  for(std::size_t i=0; i<nb_points; ++i)
+    points.push_back(Weighted_point(*gen++, rnd.get_double(0, max_weight)));
+
+  std::cout << nb_points << " weighted points, weights in [0, " << max_weight << "]" << std::endl;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  RT rt(points.begin(), points.end());
+  timer.stop();
+  std::cout << "Sequential_tag:        " << timer.time() << " s, "
+            << nb_points - rt.number_of_vertices() << " hidden points" << std::endl;
+
+  const int max_threads = tbb::info::default_concurrency();
+  for(int nb_threads = 1; ; nb_threads = (std::min)(2 * nb_threads, max_threads))
+  {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+
+    // the lock data structure is a grid over the bounding box of the points
+    RT_parallel::Lock_data_structure locking_ds(CGAL::Bbox_3(-1., -1., -1., 1., 1., 1.), 50);
+
+    timer.reset();
+    timer.start();
+    RT_parallel rtp(points.begin(), points.end(), &locking_ds);
+    timer.stop();
+    std::cout << "Parallel_tag, " << nb_threads << " thread(s): " << timer.time() << " s, "
+              << nb_points - rtp.number_of_vertices() << " hidden points" << std::endl;
+
+    if(nb_threads == max_threads)
+      break;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+// Compares the location of random query points in a Delaunay triangulation:
+// plain `locate()`, `locate()` in a Delaunay hierarchy, and the grid accelerator
+// `Triangulation_locate_grid_3`, one query at a time or in batch.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_locate_grid_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef CGAL::Delaunay_triangulation_3<K>                        DT;
+typedef CGAL::Delaunay_triangulation_3<K, CGAL::Fast_location>   DH;
+typedef CGAL::Triangulation_locate_grid_3<DT>                    Grid;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t nb_points  = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const std::size_t nb_queries = (argc > 2) ? std::atoi(argv[2]) : 1000000;
+
+  CGAL::Random rnd(0);
+  std::vector<Point> points, queries;
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+  std::copy_n(gen, nb_points, std::back_inserter(points));
+  std::copy_n(gen, nb_queries, std::back_inserter(queries));
+  std::cout << nb_points << " points, " << nb_queries << " random queries" << std::endl;
+
+  DT dt(points.begin(), points.end());
+  CGAL::Real_timer timer;
+  std::size_t check = 0;
+
+  timer.start();
+  for(const Point& q : queries)
+    check += dt.is_infinite(dt.locate(q));
+  timer.stop();
+  std::cout << "locate():                     " << timer.time() << " s" << std::endl;
+
+  {
+    DH dh(points.begin(), points.end());
+    timer.reset();
+    timer.start();
+    for(const Point& q : queries)
+      check += dh.is_infinite(dh.locate(q));
+    timer.stop();
+    std::cout << "locate() in the hierarchy:    " << timer.time() << " s" << std::endl;
+  }
+
+  timer.reset();
+  timer.start();
+  Grid grid(dt);
+  timer.stop();
+  std::cout << "grid construction:            " << timer.time() << " s ("
+            << grid.resolution() << "^3 grid cells)" << std::endl;
+
+  timer.reset();
+  timer.start();
+  for(const Point& q : queries)
+    check += dt.is_infinite(grid.locate(q));
+  timer.stop();
+  std::cout << "grid locate():                " << timer.time() << " s" << std::endl;
+
+  std::vector<DT::Cell_handle> cells;
+  cells.reserve(nb_queries);
+  timer.reset();
+  timer.start();
+  grid.locate(queries, std::back_inserter(cells));
+  timer.stop();
+  std::cout << "grid batch locate():          " << timer.time() << " s" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  cells.clear();
+  timer.reset();
+  timer.start();
+  grid.locate<CGAL::Parallel_tag>(queries, std::back_inserter(cells));
+  timer.stop();
+  std::cout << "parallel grid batch locate(): " << timer.time() << " s" << std::endl;
+#endif
+
+  std::cout << check << " queries outside the convex hull" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -208,6 +208,18 @@ template < class PointInputIterator >
 std::ptrdiff_t
 insert(PointInputIterator first, PointInputIterator last);
 
+/*!
+Same as above, with the points spatially sorted using the strategy `policy`
+(see `spatial_sort()`). `Hilbert_sort_radix_policy` is usually faster than the default
+`Hilbert_sort_median_policy` on large, evenly distributed inputs.
+
+\tparam PointInputIterator must be an input iterator with the value type `Point`.
+\tparam PolicyTag is `Median`, `Middle`, or `Radix`.
+*/
+template < class PointInputIterator, class PolicyTag >
+std::ptrdiff_t
+insert(PointInputIterator first, PointInputIterator last, Hilbert_policy<PolicyTag> policy);
+
 /*!
 Inserts the points in the iterator range  `[first,last)`.
 Returns the number of inserted points.
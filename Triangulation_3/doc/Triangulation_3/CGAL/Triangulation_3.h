@@ -365,6 +365,19 @@ Deletes all finite vertices and all cells of `t`.
 */
 void clear();
 
+/*!
+Moves the vertices and cells of `t` to new containers: the vertices are sorted
+along a Hilbert curve (see `hilbert_sort()`), and the cells are stored
+next to their vertices. After many insertions and removals, this makes
+iterating over and walking in the triangulation faster, and releases the memory
+of the removed elements.
+
+All handles and iterators on vertices and cells are invalidated.
+
+\sa `Triangulation_data_structure_3::compact()`
+*/
+void compact();
+
 /*!
 Equality operator. Returns `true` iff there exist a bijection between the
 vertices of `t1` and those of `t2` and a bijection between the cells of
@@ -0,0 +1,110 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgTriangulation3TriangulationClasses
+
+The class `Triangulation_locate_grid_3` speeds up point location in a 3D
+triangulation. It maintains a uniform grid over the bounding box of the
+vertices of the triangulation, each grid cell storing a vertex close to its
+center. A query first looks up the grid cell containing the query point, then
+walks in the triangulation from the vertex of this grid cell.
+
+Compared to `Triangulation_hierarchy_3`, the grid uses one handle per grid
+cell, and is built for an existing triangulation. The grid remains valid
+when points are inserted in a `Triangulation_3` or a `Delaunay_triangulation_3`,
+but the walks get longer in the areas where points were inserted. It must be
+updated with `update()` after the removal of vertices.
+
+\warning In a `Regular_triangulation_3`, the insertion of a weighted point
+can hide vertices, which are removed from the triangulation. The grid may
+then store handles to deleted vertices: `update()` must be called after any
+insertion in a `Regular_triangulation_3`, before the next query.
+
+\tparam Triangulation is `Triangulation_3`, `Delaunay_triangulation_3`, or `Regular_triangulation_3`.
+
+\sa `CGAL::Triangulation_3::locate()`
+*/
+template< typename Triangulation >
+class Triangulation_locate_grid_3 {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+
+*/
+typedef Triangulation::Point Point;
+
+/*!
+
+*/
+typedef Triangulation::Vertex_handle Vertex_handle;
+
+/*!
+
+*/
+typedef Triangulation::Cell_handle Cell_handle;
+
+/*!
+
+*/
+typedef Triangulation::Locate_type Locate_type;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+builds the grid for `tr`, with about `vertices_per_grid_cell` vertices of
+`tr` per grid cell. `tr` must outlive the grid.
+*/
+Triangulation_locate_grid_3(const Triangulation& tr, double vertices_per_grid_cell = 4.);
+
+/*!
+rebuilds the grid from the current vertices of the triangulation.
+*/
+void update();
+
+/// @}
+
+/// \name Queries
+/// @{
+
+/*!
+returns a vertex close to `p`, or the default constructed handle if the
+dimension of the triangulation was smaller than 3 when the grid was built.
+*/
+Vertex_handle nearby_vertex(const Point& p) const;
+
+/*!
+same as `Triangulation_3::locate(p, lt, li, lj, start)`, with `start` being
+the cell of `nearby_vertex(p)`.
+*/
+Cell_handle locate(const Point& p, Locate_type& lt, int& li, int& lj) const;
+
+/*!
+same as above, without the location type.
+*/
+Cell_handle locate(const Point& p) const;
+
+/*!
+locates all the points of `points` and writes the cells containing them
+to `out`, in the order of `points`.
+The points are spatially sorted, and the walk of each point starts
+from the cell found for the previous point.
+
+\tparam ConcurrencyTag enables sequential versus parallel location.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam PointRange a model of `ConstRange` with value type `Point`.
+\tparam OutputIterator an output iterator with value type `Cell_handle`.
+*/
+template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+OutputIterator locate(const PointRange& points, OutputIterator out) const;
+
+/// @}
+
+}; /* end Triangulation_locate_grid_3 */
+
+} /* end namespace CGAL */
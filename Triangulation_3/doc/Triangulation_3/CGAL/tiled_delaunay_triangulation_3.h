@@ -0,0 +1,42 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgTriangulation3Ref
+
+builds the Delaunay triangulation `dt` of `points` tile by tile.
+
+The bounding box of `points` is divided into a regular grid of
+`tiles_per_axis`\f$^3\f$ tiles and the Delaunay triangulation of the points of each tile
+is computed independently. A cell of a tile triangulation whose circumscribed ball lies
+inside the tile cannot contain a point of another tile: it is *finalized* and is a cell of
+the final triangulation. All other cells are *unfinished*. Their vertices are gathered
+and triangulated in a merge triangulation, whose cells covering the unfinished regions are
+stitched to the finalized cells along the facets that separate finalized
+from unfinished cells. Each tile triangulation is released as soon as its finalized cells
+have been extracted, so that only one tile per thread is held in memory at a time, together
+with the vertex indices of the finalized cells and the merge triangulation.
+
+The result is identical to the triangulation obtained by inserting `points`
+in `dt` directly, including in degenerate configurations, since `Delaunay_triangulation_3`
+uses symbolic perturbation.
+
+\tparam ConcurrencyTag enables sequential versus parallel construction of the tiles.
+                       Possible values are `Sequential_tag`, `Parallel_tag`,
+                       and `Parallel_if_available_tag`.
+\tparam DT an instance of `Delaunay_triangulation_3`
+\tparam PointRange a model of `Range` whose value type is `DT::Point`
+
+\param points the input points
+\param dt the output triangulation. Its previous content is cleared.
+\param tiles_per_axis the number of tiles along each axis of the bounding box
+
+\pre `tiles_per_axis > 0`
+
+\sa `Delaunay_triangulation_3::insert()`
+*/
+template <typename ConcurrencyTag, typename DT, typename PointRange>
+void tiled_delaunay_triangulation_3(const PointRange& points,
+                                    DT& dt,
+                                    unsigned int tiles_per_axis = 2);
+
+} /* end namespace CGAL */
@@ -343,6 +343,14 @@ public:
   template < class InputIterator >
   std::ptrdiff_t insert(InputIterator first, InputIterator last)
 #endif //CGAL_TRIANGULATION_3_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
+  {
+    return insert(first, last, Hilbert_sort_median_policy());
+  }
+
+  // same as above, with the points spatially sorted using `policy`
+  template < class InputIterator, class PolicyTag >
+  std::ptrdiff_t insert(InputIterator first, InputIterator last,
+                        Hilbert_policy<PolicyTag> policy)
   {
 #ifdef CGAL_TRIANGULATION_3_PROFILING
     WallClockTimer t;
@@ -350,7 +358,7 @@ public:
 
     size_type n = number_of_vertices();
     std::vector<Point> points(first, last);
-    spatial_sort<Concurrency_tag>(points.begin(), points.end(), geom_traits());
+    spatial_sort<Concurrency_tag>(points.begin(), points.end(), geom_traits(), policy);
 
     // Parallel
 #ifdef CGAL_LINKED_WITH_TBB
@@ -350,6 +350,39 @@ private:
   }
 #endif // CGAL_CONCURRENT_TRIANGULATION_3_ADD_TEMPORARY_POINTS_ON_FAR_SPHERE
 
+  // Parameters of the multiscale sort (BRIO) of the points of a range insertion
+  static constexpr std::ptrdiff_t brio_threshold = 64;
+  static constexpr double brio_ratio = 0.125;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // Inserts the points `[first, last)` of a range `[0, last)` sorted by
+  // `spatial_sort()` with `brio_threshold` and `brio_ratio`, in parallel, by
+  // rounds that are the levels of the multiscale sort: the points of a round
+  // are only inserted once all the points of the coarser rounds are, so that
+  // the conflict zones of concurrent insertions are small and rarely overlap.
+  template <class Insert_functor>
+  void parallel_insert_by_rounds(std::size_t first, std::size_t last,
+                                 const Insert_functor& insert_functor)
+  {
+    // same boundaries as in `Multiscale_sort`
+    std::vector<std::size_t> round_ends(1, last);
+    for(std::size_t end = last; end > first && std::ptrdiff_t(end) >= brio_threshold; )
+    {
+      end = std::size_t(double(end) * brio_ratio);
+      round_ends.push_back(end);
+    }
+
+    std::size_t begin = first;
+    for(auto it = round_ends.rbegin(); it != round_ends.rend(); ++it)
+    {
+      if(*it <= begin)
+        continue;
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(begin, *it), insert_functor);
+      begin = *it;
+    }
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
 public:
 #ifndef CGAL_TRIANGULATION_3_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
   template < class InputIterator >
@@ -384,10 +417,11 @@ public:
     typedef boost::function_property_map<Construct_point_3, Weighted_point, Ret> fpmap;
     typedef CGAL::Spatial_sort_traits_adapter_3<Geom_traits, fpmap> Search_traits_3;
 
-    spatial_sort(points.begin(), points.end(),
-                 Search_traits_3(
-                   boost::make_function_property_map<Weighted_point, Ret, Construct_point_3>(
-                     geom_traits().construct_point_3_object()), geom_traits()));
+    spatial_sort<Concurrency_tag>(points.begin(), points.end(),
+                                  Search_traits_3(
+                                    boost::make_function_property_map<Weighted_point, Ret, Construct_point_3>(
+                                      geom_traits().construct_point_3_object()), geom_traits()),
+                                  Hilbert_sort_median_policy(), 0, brio_threshold, brio_ratio);
 
     // Parallel
 #ifdef CGAL_LINKED_WITH_TBB
@@ -419,8 +453,7 @@ public:
       }
 
       Hint tls_hint(hint->vertex(0));
-      tbb::parallel_for(tbb::blocked_range<size_t>(i, num_points),
-                        Insert_point<Self>(*this, points, tls_hint));
+      parallel_insert_by_rounds(i, num_points, Insert_point<Self>(*this, points, tls_hint));
 
 #ifdef CGAL_CONCURRENT_TRIANGULATION_3_ADD_TEMPORARY_POINTS_ON_FAR_SPHERE
       remove_temporary_points_on_far_sphere(far_sphere_vertices);
@@ -510,11 +543,12 @@ private:
     typedef CGAL::Spatial_sort_traits_adapter_3<Gt, fpmap> Search_traits_3;
 
     Access_bare_point accessor(points, geom_traits().construct_point_3_object());
-    spatial_sort(indices.begin(), indices.end(),
-                 Search_traits_3(
-                   boost::make_function_property_map<
-                     std::size_t, Ret, Access_bare_point>(accessor),
-                   geom_traits()));
+    spatial_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                  Search_traits_3(
+                                    boost::make_function_property_map<
+                                      std::size_t, Ret, Access_bare_point>(accessor),
+                                    geom_traits()),
+                                  Hilbert_sort_median_policy(), 0, brio_threshold, brio_ratio);
 
 #ifdef CGAL_LINKED_WITH_TBB
     if(this->is_parallel())
@@ -551,8 +585,8 @@ private:
       }
 
       Hint tls_hint(hint->vertex(0));
-      tbb::parallel_for(tbb::blocked_range<size_t>(i, num_points),
-                        Insert_point_with_info<Self>(*this, points, infos, indices, tls_hint));
+      parallel_insert_by_rounds(i, num_points,
+                                Insert_point_with_info<Self>(*this, points, infos, indices, tls_hint));
 
 #ifdef CGAL_CONCURRENT_TRIANGULATION_3_ADD_TEMPORARY_POINTS_ON_FAR_SPHERE
       remove_temporary_points_on_far_sphere(far_sphere_vertices);
@@ -1346,22 +1380,27 @@ protected:
   public:
     Hidden_point_visitor(Self *tr) : t(tr) {}
 
+    // The thread-local containers are looked up once per call:
+    // `local()` is a lookup in a concurrent table.
     template <class InputIterator>
     void process_cells_in_conflict(InputIterator start, InputIterator end) const
     {
+      std::vector<Vertex_handle>& local_vertices = vertices.local();
+      std::vector<Weighted_point>& local_hidden_points = hidden_points.local();
+
       int dim = t->dimension();
       while(start != end)
       {
         std::copy((*start)->hidden_points_begin(),
                   (*start)->hidden_points_end(),
-                  std::back_inserter(hidden_points.local()));
+                  std::back_inserter(local_hidden_points));
 
         for(int i=0; i<=dim; i++)
         {
           Vertex_handle v = (*start)->vertex(i);
           if(v->cell() != Cell_handle())
           {
-            vertices.local().push_back(v);
+            local_vertices.push_back(v);
             v->set_cell(Cell_handle());
           }
         }
@@ -1371,9 +1410,12 @@ protected:
 
     void reinsert_vertices(Vertex_handle v)
     {
+      std::vector<Vertex_handle>& local_vertices = vertices.local();
+      std::vector<Weighted_point>& local_hidden_points = hidden_points.local();
+
       Cell_handle hc = v->cell();
       for(typename std::vector<Vertex_handle>::iterator
-           vi = vertices.local().begin(); vi != vertices.local().end(); ++vi)
+           vi = local_vertices.begin(); vi != local_vertices.end(); ++vi)
       {
         if((*vi)->cell() != Cell_handle())
           continue;
@@ -1383,14 +1425,14 @@ protected:
         t->tds().delete_vertex(*vi);
       }
 
-      vertices.local().clear();
+      local_vertices.clear();
       for(typename std::vector<Weighted_point>::iterator
-           hp = hidden_points.local().begin(); hp != hidden_points.local().end(); ++hp)
+           hp = local_hidden_points.begin(); hp != local_hidden_points.end(); ++hp)
       {
         hc = t->locate(*hp, hc);
         hide_point (hc, *hp);
       }
-      hidden_points.local().clear();
+      local_hidden_points.clear();
     }
 
     Vertex_handle replace_vertex(Cell_handle c, int index, const Weighted_point& p)
@@ -33,6 +33,7 @@
 #include <CGAL/Triangulation_vertex_base_3.h>
 
 #include <CGAL/spatial_sort.h>
+#include <CGAL/hilbert_sort.h>
 #include <CGAL/Spatial_sort_traits_adapter_3.h>
 
 #include <CGAL/Triangulation_segment_traverser_3.h>
@@ -790,6 +791,44 @@ public:
     Base::swap(tr);
   }
 
+  // Relocates the vertices in Hilbert order and the cells next to their
+  // vertices, in new containers without freed slots.
+  // All handles and iterators are invalidated.
+  void compact()
+  {
+    if(number_of_vertices() == 0)
+      return;
+
+    typedef typename Geom_traits::Point_3 Bare_point;
+    typename Geom_traits::Construct_point_3 cp = geom_traits().construct_point_3_object();
+
+    std::vector<Vertex_handle> finite_vertices;
+    std::vector<Bare_point> points;
+    std::vector<std::size_t> indices;
+    finite_vertices.reserve(number_of_vertices());
+    points.reserve(number_of_vertices());
+    indices.reserve(number_of_vertices());
+    for(Vertex_handle v : finite_vertex_handles())
+    {
+      indices.push_back(points.size());
+      finite_vertices.push_back(v);
+      points.push_back(cp(v->point()));
+    }
+
+    typedef typename Pointer_property_map<Bare_point>::type Pmap;
+    typedef Spatial_sort_traits_adapter_3<Geom_traits, Pmap> Search_traits;
+    hilbert_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                  Search_traits(make_property_map(points), geom_traits()));
+
+    std::vector<Vertex_handle> vertices_in_order;
+    vertices_in_order.reserve(number_of_vertices() + 1);
+    vertices_in_order.push_back(infinite);
+    for(std::size_t i : indices)
+      vertices_in_order.push_back(finite_vertices[i]);
+
+    infinite = _tds.compact(vertices_in_order.begin(), vertices_in_order.end(), infinite);
+  }
+
   //ACCESS FUNCTIONS
   const GT& geom_traits() const { return _gt; }
   const Tds& tds() const { return _tds; }
@@ -160,6 +160,8 @@ public:
 
   void clear();
 
+  void compact();
+
   // CHECKING
   bool is_valid(bool verbose = false, int level = 0) const;
 
@@ -496,6 +498,26 @@ clear()
     hierarchy[i]->clear();
 }
 
+template <class Tr>
+void
+Triangulation_hierarchy_3<Tr>::
+compact()
+{
+  // Levels are compacted from the bottom: when a level is compacted, the
+  // vertices of the level below are already at their final place, and the
+  // vertices of the level above still at their former one.
+  for(int i=0;i<maxlevel;++i) {
+    hierarchy[i]->Tr_Base::compact();
+    for( Finite_vertices_iterator it = hierarchy[i]->finite_vertices_begin(),
+         end = hierarchy[i]->finite_vertices_end(); it != end; ++it) {
+      if (it->down() != Vertex_handle())
+        it->down()->set_up(it);
+      if (it->up() != Vertex_handle())
+        it->up()->set_down(it);
+    }
+  }
+}
+
 template <class Tr>
 bool
 Triangulation_hierarchy_3<Tr>::
@@ -0,0 +1,275 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_TRIANGULATION_LOCATE_GRID_3_H
+#define CGAL_TRIANGULATION_LOCATE_GRID_3_H
+
+#include <CGAL/license/Triangulation_3.h>
+
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+
+// A uniform grid over the bounding box of the vertices of a 3D triangulation.
+// Each grid cell stores a vertex close to its center, which is used as the
+// starting point of the walk of `locate()`.
+// Insertions in a `Triangulation_3` or a `Delaunay_triangulation_3` keep the
+// grid valid (but the hints become less accurate), removals require a call
+// to `update()`. In a `Regular_triangulation_3`, an insertion can hide vertices,
+// which are then deleted: `update()` is required after any insertion.
+template < class Tr >
+class Triangulation_locate_grid_3
+{
+public:
+  typedef Tr                                           Triangulation;
+  typedef typename Tr::Geom_traits                     Geom_traits;
+  typedef typename Tr::Point                           Point;
+  typedef typename Tr::Vertex_handle                   Vertex_handle;
+  typedef typename Tr::Cell_handle                     Cell_handle;
+  typedef typename Tr::Locate_type                     Locate_type;
+
+private:
+  typedef typename Geom_traits::Point_3                Bare_point;
+
+  const Tr& _tr;
+  double _vertices_per_grid_cell;
+  std::size_t _resolution;
+  double _origin[3];
+  double _inverse_step;
+  std::vector<Vertex_handle> _grid;
+
+public:
+  explicit Triangulation_locate_grid_3(const Tr& tr, double vertices_per_grid_cell = 4.)
+    : _tr(tr), _vertices_per_grid_cell(vertices_per_grid_cell),
+      _resolution(0), _inverse_step(0)
+  {
+    CGAL_precondition(vertices_per_grid_cell > 0);
+    update();
+  }
+
+  const Triangulation& triangulation() const { return _tr; }
+
+  std::size_t resolution() const { return _resolution; }
+
+  // Rebuilds the grid from the current vertices of the triangulation.
+  void update()
+  {
+    _grid.clear();
+    _resolution = 0;
+    if(_tr.dimension() < 3)
+      return;
+
+    double mini[3] = { (std::numeric_limits<double>::max)(),
+                       (std::numeric_limits<double>::max)(),
+                       (std::numeric_limits<double>::max)() };
+    double maxi[3] = { -mini[0], -mini[1], -mini[2] };
+    for(auto vit = _tr.finite_vertices_begin(); vit != _tr.finite_vertices_end(); ++vit)
+    {
+      double c[3];
+      coordinates(vit->point(), c);
+      for(int d=0; d<3; ++d) {
+        mini[d] = (std::min)(mini[d], c[d]);
+        maxi[d] = (std::max)(maxi[d], c[d]);
+      }
+    }
+
+    const double extent = (std::max)((std::max)(maxi[0] - mini[0], maxi[1] - mini[1]),
+                                     maxi[2] - mini[2]);
+    const double nb_grid_cells = double(_tr.number_of_vertices()) / _vertices_per_grid_cell;
+    _resolution = (std::max)(std::size_t(1), std::size_t(std::cbrt(nb_grid_cells)));
+    for(int d=0; d<3; ++d)
+      _origin[d] = mini[d];
+    _inverse_step = (extent > 0) ? double(_resolution) / extent : 0.;
+
+    // keep in each grid cell the vertex closest to its center
+    _grid.assign(_resolution * _resolution * _resolution, Vertex_handle());
+    std::vector<double> distances(_grid.size(), (std::numeric_limits<double>::max)());
+    for(auto vit = _tr.finite_vertices_begin(); vit != _tr.finite_vertices_end(); ++vit)
+    {
+      double c[3];
+      coordinates(vit->point(), c);
+      std::size_t g[3];
+      grid_coordinates(c, g);
+      double sq_dist = 0;
+      for(int d=0; d<3; ++d) {
+        const double delta = (c[d] - _origin[d]) * _inverse_step - (double(g[d]) + 0.5);
+        sq_dist += delta * delta;
+      }
+      const std::size_t i = index(g);
+      if(sq_dist < distances[i]) {
+        distances[i] = sq_dist;
+        _grid[i] = vit;
+      }
+    }
+
+    // empty grid cells get the vertex of a nearest non-empty grid cell,
+    // with a breadth-first traversal of the grid
+    std::vector<std::size_t> front, next_front;
+    for(std::size_t i=0; i<_grid.size(); ++i)
+      if(_grid[i] != Vertex_handle())
+        front.push_back(i);
+
+    const std::size_t r = _resolution;
+    const std::size_t strides[3] = { 1, r, r * r };
+    while(!front.empty())
+    {
+      next_front.clear();
+      for(std::size_t i : front)
+      {
+        const std::size_t g[3] = { i % r, (i / r) % r, i / (r * r) };
+        for(int d=0; d<3; ++d)
+        {
+          if(g[d] > 0 && _grid[i - strides[d]] == Vertex_handle()) {
+            _grid[i - strides[d]] = _grid[i];
+            next_front.push_back(i - strides[d]);
+          }
+          if(g[d] + 1 < r && _grid[i + strides[d]] == Vertex_handle()) {
+            _grid[i + strides[d]] = _grid[i];
+            next_front.push_back(i + strides[d]);
+          }
+        }
+      }
+      front.swap(next_front);
+    }
+  }
+
+  // Returns a vertex close to `p`, or the default constructed handle
+  // if the triangulation has dimension smaller than 3.
+  Vertex_handle nearby_vertex(const Point& p) const
+  {
+    if(_grid.empty())
+      return Vertex_handle();
+    double c[3];
+    coordinates(p, c);
+    std::size_t g[3];
+    grid_coordinates(c, g);
+    return _grid[index(g)];
+  }
+
+  Cell_handle locate(const Point& p, Locate_type& lt, int& li, int& lj) const
+  {
+    const Vertex_handle v = nearby_vertex(p);
+    return _tr.locate(p, lt, li, lj, (v == Vertex_handle()) ? Cell_handle() : v->cell());
+  }
+
+  Cell_handle locate(const Point& p) const
+  {
+    Locate_type lt;
+    int li, lj;
+    return locate(p, lt, li, lj);
+  }
+
+  // Locates all the points of `points` and writes the cells containing them
+  // to `out`, in the order of `points`. The queries are spatially sorted and
+  // each walk starts from the cell of the previous query.
+  template <class ConcurrencyTag = Sequential_tag, class PointRange, class OutputIterator>
+  OutputIterator locate(const PointRange& points, OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    std::vector<const Point*> queries;
+    std::vector<Bare_point> bare_points;
+    for(const Point& p : points) {
+      queries.push_back(&p);
+      bare_points.push_back(_tr.construct_point(p));
+    }
+
+    const std::size_t n = queries.size();
+    std::vector<std::size_t> order(n);
+    for(std::size_t i=0; i<n; ++i)
+      order[i] = i;
+
+    typedef typename Pointer_property_map<Bare_point>::type Pmap;
+    typedef Spatial_sort_traits_adapter_3<Geom_traits, Pmap> Search_traits;
+    spatial_sort<ConcurrencyTag>(order.begin(), order.end(),
+                                 Search_traits(make_property_map(bare_points), _tr.geom_traits()));
+
+    std::vector<Cell_handle> cells(n);
+    auto locate_sequence = [&](std::size_t first, std::size_t last)
+    {
+      Cell_handle c;
+      for(std::size_t k=first; k<last; ++k)
+      {
+        const Point& p = *queries[order[k]];
+        Locate_type lt;
+        int li, lj;
+        if(c == Cell_handle())
+          c = locate(p, lt, li, lj);
+        else
+          c = _tr.locate(p, lt, li, lj, c);
+        cells[order[k]] = c;
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, 1024),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          locate_sequence(r.begin(), r.end());
+                        });
+    }
+    else
+#endif
+    {
+      locate_sequence(0, n);
+    }
+
+    return std::copy(cells.begin(), cells.end(), out);
+  }
+
+private:
+  void coordinates(const Point& p, double c[3]) const
+  {
+    const Bare_point& bp = _tr.construct_point(p);
+    c[0] = to_double(_tr.geom_traits().compute_x_3_object()(bp));
+    c[1] = to_double(_tr.geom_traits().compute_y_3_object()(bp));
+    c[2] = to_double(_tr.geom_traits().compute_z_3_object()(bp));
+  }
+
+  void grid_coordinates(const double c[3], std::size_t g[3]) const
+  {
+    const double max_coordinate = double(_resolution - 1);
+    for(int d=0; d<3; ++d) {
+      const double x = (c[d] - _origin[d]) * _inverse_step;
+      g[d] = (x > 0) ? std::size_t((std::min)(x, max_coordinate)) : 0;
+    }
+  }
+
+  std::size_t index(const std::size_t g[3]) const
+  {
+    return g[0] + _resolution * (g[1] + _resolution * g[2]);
+  }
+};
+
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_LOCATE_GRID_3_H
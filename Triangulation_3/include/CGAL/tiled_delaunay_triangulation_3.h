@@ -0,0 +1,459 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : CGAL contributors
+
+#ifndef CGAL_TILED_DELAUNAY_TRIANGULATION_3_H
+#define CGAL_TILED_DELAUNAY_TRIANGULATION_3_H
+
+#include <CGAL/license/Triangulation_3.h>
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Delaunay_triangulation_cell_base_3.h>
+#include <CGAL/Triangulation_cell_base_with_info_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/constructions/kernel_ftC3.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <boost/unordered_map.hpp>
+#include <boost/unordered_set.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+namespace Tiled_DT_3 {
+
+typedef std::array<std::size_t, 3>                        Facet_key;
+typedef std::array<std::size_t, 4>                        Cell_ids;
+
+inline Facet_key make_facet_key(std::size_t a, std::size_t b, std::size_t c)
+{
+  Facet_key k = {{a, b, c}};
+  std::sort(k.begin(), k.end());
+  return k;
+}
+
+// Output of the construction of the triangulation of a single tile.
+// Only indices are kept, so that the triangulation of the tile can be
+// released as soon as it has been processed.
+struct Tile_result
+{
+  // finite cells that are cells of the global triangulation, positively oriented
+  std::vector<Cell_ids> finalized_cells;
+  // facets shared by a finalized and an unfinalized cell: the three vertices
+  // of the facet followed by the opposite vertex in the finalized cell
+  std::vector<Cell_ids> interface_facets;
+  // vertices incident to at least one unfinalized cell
+  std::vector<std::size_t> boundary_vertices;
+};
+
+// Returns `true` if the closed circumscribed ball of `p0p1p2p3` is certainly
+// contained in the open box `box` (xmin, ymin, zmin, xmax, ymax, zmax). The test
+// is conservative: it may return `false` for balls that are inside the box.
+template <typename Point>
+bool ball_certainly_in_box(const Point& p0, const Point& p1,
+                           const Point& p2, const Point& p3,
+                           const std::array<double, 6>& box)
+{
+  typedef Interval_nt_advanced                            IT;
+  Protect_FPU_rounding<true> protection;
+
+  std::array<IT, 3> c0 = {{ to_interval(p0.x()), to_interval(p0.y()), to_interval(p0.z()) }};
+
+  IT num_x, num_y, num_z, den;
+  determinants_for_circumcenterC3(c0[0], c0[1], c0[2],
+                                  IT(to_interval(p1.x())), IT(to_interval(p1.y())), IT(to_interval(p1.z())),
+                                  IT(to_interval(p2.x())), IT(to_interval(p2.y())), IT(to_interval(p2.z())),
+                                  IT(to_interval(p3.x())), IT(to_interval(p3.y())), IT(to_interval(p3.z())),
+                                  num_x, num_y, num_z, den);
+
+  // a flat (or nearly flat) tetrahedron is never finalized
+  if(!certainly(den != 0))
+    return false;
+
+  const IT inv = 1 / (2 * den);
+  const std::array<IT, 3> offset = {{ num_x * inv, - num_y * inv, num_z * inv }};
+  const IT sq_radius = square(offset[0]) + square(offset[1]) + square(offset[2]);
+
+  for(int a=0; a<3; ++a)
+  {
+    const IT center = c0[a] + offset[a];
+    if(box[a] != -std::numeric_limits<double>::infinity())
+    {
+      const IT d = center - box[a];
+      if(!certainly(d > 0) || !certainly(square(d) > sq_radius))
+        return false;
+    }
+    if(box[a+3] != std::numeric_limits<double>::infinity())
+    {
+      const IT d = box[a+3] - center;
+      if(!certainly(d > 0) || !certainly(square(d) > sq_radius))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename DT>
+struct Tiling_traits
+{
+  typedef typename DT::Geom_traits                                  Geom_traits;
+  typedef typename DT::Point                                        Point;
+
+  typedef Triangulation_vertex_base_with_info_3<std::size_t, Geom_traits> Vb;
+  typedef Delaunay_triangulation_cell_base_3<Geom_traits>           Cbb;
+  typedef Triangulation_cell_base_with_info_3<bool, Geom_traits, Cbb> Cb;
+  typedef Triangulation_data_structure_3<Vb, Cb>                    Tds;
+  typedef Delaunay_triangulation_3<Geom_traits, Tds>                Local_triangulation;
+};
+
+template <typename DT>
+struct Tile
+{
+  typedef typename Tiling_traits<DT>::Point                         Point;
+  typedef typename Tiling_traits<DT>::Local_triangulation           Local_triangulation;
+  typedef typename Local_triangulation::Cell_handle                 Cell_handle;
+  typedef typename Local_triangulation::Vertex_handle               Vertex_handle;
+
+  std::array<double, 6> box;
+  std::vector<std::pair<Point, std::size_t> > points;
+  Tile_result result;
+
+  void process()
+  {
+    Local_triangulation ldt(points.begin(), points.end());
+    std::vector<std::pair<Point, std::size_t> >().swap(points);
+
+    if(ldt.dimension() < 3)
+    {
+      for(Vertex_handle v : ldt.finite_vertex_handles())
+        result.boundary_vertices.push_back(v->info());
+      return;
+    }
+
+    for(Cell_handle c : ldt.all_cell_handles())
+    {
+      c->info() = !ldt.is_infinite(c) &&
+                  ball_certainly_in_box(c->vertex(0)->point(), c->vertex(1)->point(),
+                                        c->vertex(2)->point(), c->vertex(3)->point(), box);
+    }
+
+    for(Cell_handle c : ldt.all_cell_handles())
+    {
+      if(c->info())
+      {
+        result.finalized_cells.push_back(Cell_ids{{ c->vertex(0)->info(), c->vertex(1)->info(),
+                                                    c->vertex(2)->info(), c->vertex(3)->info() }});
+        for(int i=0; i<4; ++i)
+        {
+          if(c->neighbor(i)->info())
+            continue;
+          result.interface_facets.push_back(
+            Cell_ids{{ c->vertex((i+1)&3)->info(), c->vertex((i+2)&3)->info(),
+                       c->vertex((i+3)&3)->info(), c->vertex(i)->info() }});
+        }
+      }
+      else
+      {
+        for(int i=0; i<4; ++i)
+          if(!ldt.is_infinite(c->vertex(i)))
+            result.boundary_vertices.push_back(c->vertex(i)->info());
+      }
+    }
+
+    std::sort(result.boundary_vertices.begin(), result.boundary_vertices.end());
+    result.boundary_vertices.erase(std::unique(result.boundary_vertices.begin(),
+                                               result.boundary_vertices.end()),
+                                   result.boundary_vertices.end());
+  }
+};
+
+// Creates the cells of `dt` from finite cells given by global vertex ids,
+// and closes the triangulation with infinite cells on convex hull facets.
+template <typename DT, typename CellIdRange>
+void build_triangulation(DT& dt,
+                         const std::vector<typename DT::Point>& points,
+                         const CellIdRange& cells)
+{
+  typedef typename DT::Triangulation_data_structure                 Tds;
+  typedef typename DT::Vertex_handle                                Vertex_handle;
+  typedef typename DT::Cell_handle                                  Cell_handle;
+
+  Tds& tds = dt.tds();
+  tds.clear();
+  const std::size_t infinite_id = points.size();
+  dt.set_infinite_vertex(tds.create_vertex());
+  tds.set_dimension(3);
+
+  std::vector<Vertex_handle> vertices(points.size() + 1);
+  vertices[infinite_id] = dt.infinite_vertex();
+
+  auto vertex = [&](std::size_t id) -> Vertex_handle
+  {
+    Vertex_handle& v = vertices[id];
+    if(v == Vertex_handle())
+    {
+      v = tds.create_vertex();
+      v->set_point(points[id]);
+    }
+    return v;
+  };
+
+  boost::unordered_map<Facet_key, std::pair<Cell_handle, int> > open_facets;
+  auto glue = [&](Cell_handle c, const Cell_ids& ids)
+  {
+    for(int i=0; i<4; ++i)
+    {
+      c->vertex(i)->set_cell(c);
+      const Facet_key k = make_facet_key(ids[(i+1)&3], ids[(i+2)&3], ids[(i+3)&3]);
+      auto res = open_facets.emplace(k, std::make_pair(c, i));
+      if(!res.second)
+      {
+        tds.set_adjacency(c, i, res.first->second.first, res.first->second.second);
+        open_facets.erase(res.first);
+      }
+    }
+  };
+
+  for(const Cell_ids& ids : cells)
+  {
+    Cell_handle c = tds.create_cell(vertex(ids[0]), vertex(ids[1]), vertex(ids[2]), vertex(ids[3]));
+    glue(c, ids);
+  }
+
+  // the remaining open facets are on the convex hull
+  std::vector<std::pair<Cell_handle, int> > hull_facets;
+  hull_facets.reserve(open_facets.size());
+  for(const auto& f : open_facets)
+    hull_facets.push_back(f.second);
+  open_facets.clear();
+
+  boost::unordered_map<Vertex_handle, std::size_t> ids_of_hull_vertices;
+  auto id_of = [&](Vertex_handle v) -> std::size_t
+  {
+    if(v == dt.infinite_vertex())
+      return infinite_id;
+    return ids_of_hull_vertices.emplace(v, ids_of_hull_vertices.size()).first->second;
+  };
+
+  for(const std::pair<Cell_handle, int>& f : hull_facets)
+  {
+    Cell_handle c = f.first;
+    const int i = f.second;
+    std::array<Vertex_handle, 4> vs = {{ c->vertex(0), c->vertex(1), c->vertex(2), c->vertex(3) }};
+    vs[i] = dt.infinite_vertex();
+    std::swap(vs[(i+1)&3], vs[(i+2)&3]);
+
+    Cell_handle ic = tds.create_cell(vs[0], vs[1], vs[2], vs[3]);
+    tds.set_adjacency(ic, i, c, i);
+
+    // the facet opposite to the infinite vertex is already glued
+    for(int j=0; j<4; ++j)
+    {
+      vs[j]->set_cell(ic);
+      if(j == i)
+        continue;
+      const Facet_key k = make_facet_key(id_of(vs[(j+1)&3]), id_of(vs[(j+2)&3]), id_of(vs[(j+3)&3]));
+      auto res = open_facets.emplace(k, std::make_pair(ic, j));
+      if(!res.second)
+      {
+        tds.set_adjacency(ic, j, res.first->second.first, res.first->second.second);
+        open_facets.erase(res.first);
+      }
+    }
+  }
+
+  CGAL_postcondition(open_facets.empty());
+}
+
+} // namespace Tiled_DT_3
+} // namespace internal
+
+// Builds the Delaunay triangulation of the points of each tile of a regular grid,
+// keeps the cells whose circumscribed ball is inside their tile, and triangulates
+// the vertices of the other cells in a merge triangulation, whose cells covering
+// the unfinished regions are stitched to the kept cells.
+template <typename ConcurrencyTag, typename DT, typename PointRange>
+void tiled_delaunay_triangulation_3(const PointRange& points,
+                                    DT& dt,
+                                    unsigned int tiles_per_axis = 2)
+{
+  typedef internal::Tiled_DT_3::Tiling_traits<DT>                   Tiling_traits;
+  typedef internal::Tiled_DT_3::Tile<DT>                            Tile;
+  typedef internal::Tiled_DT_3::Cell_ids                            Cell_ids;
+  typedef internal::Tiled_DT_3::Facet_key                           Facet_key;
+  typedef typename Tiling_traits::Local_triangulation               Local_triangulation;
+  typedef typename Local_triangulation::Vertex_handle               Local_vertex_handle;
+  typedef typename Local_triangulation::Cell_handle                 Local_cell_handle;
+  typedef typename DT::Point                                        Point;
+  typedef typename DT::Geom_traits::FT                              FT;
+
+  CGAL_precondition(tiles_per_axis > 0);
+
+  dt.clear();
+
+  std::vector<Point> input(points.begin(), points.end());
+  if(input.empty())
+    return;
+
+  Bbox_3 bbox = input.front().bbox();
+  for(const Point& p : input)
+    bbox += p.bbox();
+
+  // interior tile boundaries along each axis
+  const unsigned int n = tiles_per_axis;
+  std::array<std::vector<double>, 3> bounds;
+  for(int a=0; a<3; ++a)
+  {
+    const double step = (bbox.max(a) - bbox.min(a)) / n;
+    for(unsigned int k=1; k<n; ++k)
+      bounds[a].push_back(bbox.min(a) + k * step);
+  }
+
+  std::vector<Tile> tiles(n * n * n);
+  for(unsigned int i=0; i<n; ++i)
+    for(unsigned int j=0; j<n; ++j)
+      for(unsigned int k=0; k<n; ++k)
+      {
+        const std::array<unsigned int, 3> t = {{ i, j, k }};
+        std::array<double, 6>& box = tiles[(i * n + j) * n + k].box;
+        for(int a=0; a<3; ++a)
+        {
+          box[a] = (t[a] == 0) ? -std::numeric_limits<double>::infinity() : bounds[a][t[a]-1];
+          box[a+3] = (t[a] == n-1) ? std::numeric_limits<double>::infinity() : bounds[a][t[a]];
+        }
+      }
+
+  // A point belongs to tile `t` along axis `a` iff `bounds[a][t-1] <= p[a] < bounds[a][t]`.
+  // The comparison is exact so that the boxes used for the finalization test are exact.
+  for(std::size_t id=0; id<input.size(); ++id)
+  {
+    const Point& p = input[id];
+    std::array<std::size_t, 3> t;
+    for(int a=0; a<3; ++a)
+    {
+      const FT c = p.cartesian(a);
+      t[a] = std::upper_bound(bounds[a].begin(), bounds[a].end(), c,
+                              [](const FT& x, double b) { return x < FT(b); }) - bounds[a].begin();
+    }
+    tiles[(t[0] * n + t[1]) * n + t[2]].points.emplace_back(p, id);
+  }
+
+  CGAL::for_each<ConcurrencyTag>(tiles, [](Tile& tile) -> bool { tile.process(); return true; });
+
+  // merge triangulation of the vertices of unfinished cells
+  std::vector<std::pair<Point, std::size_t> > boundary_points;
+  for(const Tile& tile : tiles)
+    for(std::size_t id : tile.result.boundary_vertices)
+      boundary_points.emplace_back(input[id], id);
+
+  Local_triangulation merge_dt(boundary_points.begin(), boundary_points.end());
+  std::vector<std::pair<Point, std::size_t> >().swap(boundary_points);
+
+  if(merge_dt.dimension() < 3)
+  {
+    // all tiles are degenerate, the merge triangulation contains all the points
+    dt.insert(input.begin(), input.end());
+    return;
+  }
+
+  boost::unordered_map<std::size_t, Local_vertex_handle> merge_vertices;
+  for(Local_vertex_handle v : merge_dt.finite_vertex_handles())
+    merge_vertices.emplace(v->info(), v);
+
+  for(Local_cell_handle c : merge_dt.all_cell_handles())
+    c->info() = false;
+
+  // The interface facets separate the region covered by finalized cells from the rest.
+  // Flag the cells of the merge triangulation lying on the finalized side and propagate
+  // the flag without crossing interface facets: the cells that are left are the cells
+  // of the final triangulation that are not finalized.
+  boost::unordered_set<Facet_key> interface_facets;
+  std::vector<Local_cell_handle> queue;
+  typename DT::Geom_traits::Orientation_3 orientation = dt.geom_traits().orientation_3_object();
+  for(const Tile& tile : tiles)
+  {
+    for(const Cell_ids& f : tile.result.interface_facets)
+    {
+      interface_facets.insert(internal::Tiled_DT_3::make_facet_key(f[0], f[1], f[2]));
+
+      Local_vertex_handle u = merge_vertices.at(f[0]), v = merge_vertices.at(f[1]), w = merge_vertices.at(f[2]);
+      Local_cell_handle c;
+      int i, j, k;
+      bool is_facet = merge_dt.is_facet(u, v, w, c, i, j, k);
+      CGAL_assertion(is_facet);
+      CGAL_USE(is_facet);
+      const int fi = 6 - i - j - k;
+
+      Local_cell_handle finalized_side = c->neighbor(fi);
+      if(!merge_dt.is_infinite(c->vertex(fi)) &&
+         orientation(u->point(), v->point(), w->point(), input[f[3]]) ==
+           orientation(u->point(), v->point(), w->point(), c->vertex(fi)->point()))
+        finalized_side = c;
+
+      CGAL_assertion(!merge_dt.is_infinite(finalized_side));
+      if(!finalized_side->info())
+      {
+        finalized_side->info() = true;
+        queue.push_back(finalized_side);
+      }
+    }
+  }
+
+  while(!queue.empty())
+  {
+    Local_cell_handle c = queue.back();
+    queue.pop_back();
+    for(int i=0; i<4; ++i)
+    {
+      Local_cell_handle nc = c->neighbor(i);
+      if(nc->info())
+        continue;
+      if(interface_facets.count(internal::Tiled_DT_3::make_facet_key(c->vertex((i+1)&3)->info(),
+                                                                     c->vertex((i+2)&3)->info(),
+                                                                     c->vertex((i+3)&3)->info())) != 0)
+        continue;
+      CGAL_assertion(!merge_dt.is_infinite(nc));
+      nc->info() = true;
+      queue.push_back(nc);
+    }
+  }
+
+  std::vector<Cell_ids> cells;
+  for(Tile& tile : tiles)
+  {
+    cells.insert(cells.end(), tile.result.finalized_cells.begin(), tile.result.finalized_cells.end());
+    std::vector<Cell_ids>().swap(tile.result.finalized_cells);
+  }
+  for(Local_cell_handle c : merge_dt.finite_cell_handles())
+  {
+    if(!c->info())
+      cells.push_back(Cell_ids{{ c->vertex(0)->info(), c->vertex(1)->info(),
+                                 c->vertex(2)->info(), c->vertex(3)->info() }});
+  }
+
+  internal::Tiled_DT_3::build_triangulation(dt, input, cells);
+
+  CGAL_expensive_postcondition(dt.is_valid());
+}
+
+} // namespace CGAL
+
+#endif // CGAL_TILED_DELAUNAY_TRIANGULATION_3_H
@@ -0,0 +1,104 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/Triangulation_locate_grid_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point;
+typedef K::Weighted_point_3                                 Weighted_point;
+typedef CGAL::Delaunay_triangulation_3<K>                   DT;
+typedef CGAL::Regular_triangulation_3<K>                    RT;
+
+// checks that `c` contains `p`, possibly on its boundary
+template <typename Tr>
+bool contains(const Tr& tr, typename Tr::Cell_handle c, const typename Tr::Point& p)
+{
+  typename Tr::Locate_type lt;
+  int li, lj;
+  return tr.side_of_cell(p, c, lt, li, lj) != CGAL::ON_UNBOUNDED_SIDE;
+}
+
+template <typename ConcurrencyTag, typename Tr>
+void test(const Tr& tr, const std::vector<typename Tr::Point>& queries)
+{
+  CGAL::Triangulation_locate_grid_3<Tr> grid(tr);
+
+  for(const typename Tr::Point& q : queries)
+    assert(contains(tr, grid.locate(q), q));
+
+  std::vector<typename Tr::Cell_handle> cells;
+  grid.template locate<ConcurrencyTag>(queries, std::back_inserter(cells));
+  assert(cells.size() == queries.size());
+  for(std::size_t i=0; i<queries.size(); ++i)
+    assert(contains(tr, cells[i], queries[i]));
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::cout << "Seed: " << rnd.get_seed() << std::endl;
+
+  std::vector<Point> points, queries;
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+  std::copy_n(gen, 20000, std::back_inserter(points));
+  CGAL::Random_points_in_cube_3<Point> query_gen(1.2, rnd);
+  std::copy_n(query_gen, 20000, std::back_inserter(queries));
+  // queries on vertices
+  queries.insert(queries.end(), points.begin(), points.begin() + 100);
+
+  DT dt(points.begin(), points.end());
+  test<CGAL::Sequential_tag>(dt, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>(dt, queries);
+#endif
+
+  // the grid stays usable after insertions
+  CGAL::Triangulation_locate_grid_3<DT> grid(dt);
+  for(int i=0; i<1000; ++i)
+    dt.insert(*gen++);
+  for(const Point& q : queries)
+    assert(contains(dt, grid.locate(q), q));
+
+  // a grid on a triangulation of dimension smaller than 3
+  DT flat;
+  flat.insert(Point(0, 0, 0));
+  flat.insert(Point(1, 0, 0));
+  flat.insert(Point(0, 1, 0));
+  CGAL::Triangulation_locate_grid_3<DT> flat_grid(flat);
+  assert(flat_grid.resolution() == 0);
+  DT::Locate_type lt;
+  int li, lj;
+  flat_grid.locate(Point(0.2, 0.2, 0), lt, li, lj);
+  assert(lt == DT::FACET);
+
+  std::vector<Weighted_point> weighted_points, weighted_queries;
+  for(std::size_t i=0; i<5000; ++i)
+    weighted_points.push_back(Weighted_point(points[i], rnd.get_double(0, 0.001)));
+  for(std::size_t i=0; i<5000; ++i)
+    weighted_queries.push_back(Weighted_point(queries[i], 0));
+  RT rt(weighted_points.begin(), weighted_points.end());
+  test<CGAL::Sequential_tag>(rt, weighted_queries);
+
+  // in a regular triangulation, an insertion can hide a vertex of the grid,
+  // which must then be updated
+  CGAL::Triangulation_locate_grid_3<RT> rt_grid(rt);
+  const Weighted_point& q = weighted_queries.front();
+  const Weighted_point hidden = rt_grid.nearby_vertex(q)->point();
+  rt.insert(Weighted_point(hidden.point(), 0.01));
+  // the vertex of the grid is deleted
+  for(auto v : rt.finite_vertex_handles())
+    assert(v->point().point() != hidden.point() || v->point().weight() != hidden.weight());
+  rt_grid.update();
+  assert(rt_grid.nearby_vertex(q)->point().weight() != hidden.weight());
+  for(const Weighted_point& wq : weighted_queries)
+    assert(contains(rt, rt_grid.locate(wq), wq));
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
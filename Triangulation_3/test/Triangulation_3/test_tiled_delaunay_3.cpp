@@ -0,0 +1,84 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/tiled_delaunay_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point;
+typedef CGAL::Delaunay_triangulation_3<K>                   DT;
+
+typedef std::array<Point, 4>                                Cell;
+
+std::vector<Cell> sorted_finite_cells(const DT& dt)
+{
+  std::vector<Cell> cells;
+  for(DT::Cell_handle c : dt.finite_cell_handles())
+  {
+    Cell cell = {{ c->vertex(0)->point(), c->vertex(1)->point(),
+                   c->vertex(2)->point(), c->vertex(3)->point() }};
+    std::sort(cell.begin(), cell.end());
+    cells.push_back(cell);
+  }
+  std::sort(cells.begin(), cells.end());
+  return cells;
+}
+
+template <typename ConcurrencyTag>
+void test(const std::vector<Point>& points, unsigned int tiles_per_axis)
+{
+  DT reference(points.begin(), points.end());
+
+  DT dt;
+  CGAL::tiled_delaunay_triangulation_3<ConcurrencyTag>(points, dt, tiles_per_axis);
+
+  assert(dt.is_valid());
+  assert(dt.number_of_vertices() == reference.number_of_vertices());
+  assert(dt.number_of_cells() == reference.number_of_cells());
+  assert(sorted_finite_cells(dt) == sorted_finite_cells(reference));
+
+  // the result is a regular triangulation that can still be modified
+  dt.insert(Point(0.1, 0.2, 0.3));
+  assert(dt.is_valid());
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::cout << "Seed: " << rnd.get_seed() << std::endl;
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+  std::copy_n(gen, 5000, std::back_inserter(points));
+
+  test<CGAL::Sequential_tag>(points, 1);
+  test<CGAL::Sequential_tag>(points, 3);
+  test<CGAL::Parallel_if_available_tag>(points, 4);
+
+  // degenerate configuration: cospherical points and duplicates
+  std::vector<Point> grid;
+  for(int i=0; i<10; ++i)
+    for(int j=0; j<10; ++j)
+      for(int k=0; k<10; ++k)
+        grid.emplace_back(i, j, k);
+  grid.emplace_back(3, 3, 3);
+
+  test<CGAL::Sequential_tag>(grid, 2);
+  test<CGAL::Parallel_if_available_tag>(grid, 3);
+
+  // coplanar points
+  std::vector<Point> flat;
+  for(int i=0; i<20; ++i)
+    flat.emplace_back(rnd.get_double(), rnd.get_double(), 0);
+  DT dt;
+  CGAL::tiled_delaunay_triangulation_3<CGAL::Sequential_tag>(flat, dt, 2);
+  assert(dt.dimension() == 2 && dt.number_of_vertices() == 20);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
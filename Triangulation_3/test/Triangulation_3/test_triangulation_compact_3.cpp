@@ -0,0 +1,128 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel        K;
+typedef K::Point_3                                                 Point;
+
+typedef CGAL::Delaunay_triangulation_3<K>                          Delaunay;
+typedef CGAL::Delaunay_triangulation_3<K, CGAL::Fast_location>     Delaunay_hierarchy;
+typedef CGAL::Regular_triangulation_3<K>                           Regular;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Triangulation_data_structure_3<
+          CGAL::Triangulation_vertex_base_3<K>,
+          CGAL::Delaunay_triangulation_cell_base_3<K>,
+          CGAL::Parallel_tag>                                      Parallel_tds;
+typedef CGAL::Delaunay_triangulation_3<K, Parallel_tds>            Parallel_delaunay;
+#endif
+
+template <class Tr>
+std::vector<typename Tr::Point> sorted_points(const Tr& tr)
+{
+  std::vector<typename Tr::Point> points;
+  for(auto v : tr.finite_vertex_handles())
+    points.push_back(v->point());
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+template <class Tr, class InputPoints>
+void test(Tr& tr, const InputPoints& input, const char* name)
+{
+  std::cout << "Compaction of " << name << std::endl;
+
+  // compacting an empty triangulation does nothing
+  tr.compact();
+  assert(tr.is_valid() && tr.number_of_vertices() == 0);
+
+  tr.insert(input.begin(), input.end());
+
+  // remove most of the vertices, so that the containers are full of holes
+  std::vector<typename Tr::Vertex_handle> to_remove;
+  std::size_t i = 0;
+  for(auto v : tr.finite_vertex_handles())
+    if(i++ % 4 != 0)
+      to_remove.push_back(v);
+  tr.remove(to_remove.begin(), to_remove.end());
+  assert(tr.is_valid());
+
+  const std::vector<typename Tr::Point> points = sorted_points(tr);
+  const std::size_t nb_cells = tr.number_of_cells();
+  const std::size_t vertex_capacity = tr.tds().vertices().capacity();
+  const std::size_t cell_capacity = tr.tds().cells().capacity();
+
+  // compacting does not draw from the default random generator
+  CGAL::Random rnd = CGAL::get_default_random();
+  tr.compact();
+  assert(CGAL::get_default_random().get_int(0, 1 << 30) == rnd.get_int(0, 1 << 30));
+
+  std::cout << "  vertex capacity: " << vertex_capacity << " -> " << tr.tds().vertices().capacity()
+            << ", cell capacity: " << cell_capacity << " -> " << tr.tds().cells().capacity() << std::endl;
+
+  assert(tr.is_valid());
+  assert(tr.is_infinite(tr.infinite_vertex()));
+  assert(tr.number_of_cells() == nb_cells);
+  assert(sorted_points(tr) == points);
+  assert(tr.tds().vertices().capacity() < vertex_capacity);
+  assert(tr.tds().cells().capacity() < cell_capacity);
+
+  // the triangulation can still be modified and searched
+  for(const auto& p : points)
+  {
+    typename Tr::Vertex_handle v;
+    assert(tr.is_vertex(p, v));
+  }
+  tr.insert(input.begin(), input.end());
+  assert(tr.is_valid());
+  assert(tr.number_of_vertices() == input.size());
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+
+  std::vector<Point> points;
+  std::copy_n(gen, 5000, std::back_inserter(points));
+
+  std::vector<K::Weighted_point_3> weighted_points;
+  for(const Point& p : points)
+    weighted_points.emplace_back(p, rnd.get_double(0., 0.0001));
+
+  Delaunay dt;
+  test(dt, points, "Delaunay_triangulation_3");
+
+  Delaunay_hierarchy dth;
+  test(dth, points, "Delaunay_triangulation_3 with Fast_location");
+
+  Regular rt;
+  test(rt, weighted_points, "Regular_triangulation_3");
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Parallel_delaunay::Lock_data_structure locking_ds(CGAL::Bbox_3(-1., -1., -1., 1., 1., 1.), 50);
+  Parallel_delaunay pdt(&locking_ds);
+  test(pdt, points, "parallel Delaunay_triangulation_3");
+#endif
+
+  // the TDS alone keeps the order of its vertices
+  Delaunay::Triangulation_data_structure tds = dt.tds();
+  std::vector<Point> tds_points;
+  for(auto v : tds.vertex_handles())
+    tds_points.push_back(v->point());
+  tds.compact();
+  assert(tds.is_valid());
+  std::size_t i = 0;
+  for(auto v : tds.vertex_handles())
+    assert(v->point() == tds_points[i++]);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}